@@ -26,10 +26,11 @@ extern "C"
 
 /* #include "fp_vision_app.h" */
 #include "stm32h747i_discovery.h"
-#include "stm32h747i_discovery_camera.h"
+#include "stm32h747i_discovery_camera_patch.h"
 #include "stm32h747i_discovery_lcd_patch.h"
 #include "stm32h747i_discovery_qspi.h"
 #include "stm32h747i_discovery_sdram.h"
+#include "stm32_img.h"
 
 /* Display related defines */
 #define ARGB8888_BYTE_PER_PIXEL 4
@@ -38,19 +39,109 @@ extern "C"
 #define LCD_BBP ARGB8888_BYTE_PER_PIXEL
 #define LCD_FRAME_BUFFER_SIZE (LCD_RES_WIDTH * LCD_RES_HEIGHT * LCD_BBP)
 
+/* LCD frame buffers flipped on vertical blanking: 2 for double buffering, 3 for
+ * triple buffering (rendering never waits for the display) */
+#ifndef LCD_NB_FRAME_BUFFERS
+#define LCD_NB_FRAME_BUFFERS 2
+#endif
+
+/* Camera display mode: 1 shows the camera image on its own LTDC layer (RGB565,
+ * written by the DMA2D from a native resolution grayscale image, 2x scaled if it
+ * fits), below the ARGB8888 layer used for text and graphics. 0 draws it into the
+ * ARGB8888 frame buffers. */
+#ifndef LCD_CAMERA_LAYER_MODE
+#define LCD_CAMERA_LAYER_MODE 1
+#endif
+
+/* LTDC layers: BSP_LCD drawing layer and camera layer, and drawing layer
+ * background (transparent over the camera layer) */
+#if LCD_CAMERA_LAYER_MODE
+#define LCD_UI_LAYER LTDC_ACTIVE_LAYER_FOREGROUND
+#define LCD_CAMERA_LAYER LTDC_ACTIVE_LAYER_BACKGROUND
+#define LCD_UI_BACKGROUND ((uint32_t)0x00000000)
+#else
+#define LCD_UI_LAYER LTDC_ACTIVE_LAYER_BACKGROUND
+#define LCD_UI_BACKGROUND LCD_COLOR_BLACK
+#endif
+
+/* Maximum number of damaged rectangles tracked per frame, beyond which they are
+ * merged */
+#ifndef LCD_DAMAGE_MAX_RECTS
+#define LCD_DAMAGE_MAX_RECTS 8
+#endif
+
+/* DMA2D job queue depth */
+#ifndef DMA2D_QUEUE_LENGTH
+#define DMA2D_QUEUE_LENGTH 16
+#endif
+
+  /* DMA2D job completion handle, see DMA2D_FenceDone() */
+  typedef uint32_t DMA2D_Fence_t;
+
+  /* DMA2D job description */
+  typedef struct
+  {
+    uint32_t Mode;          /* DMA2D_M2M, DMA2D_M2M_PFC, DMA2D_M2M_BLEND or DMA2D_R2M  */
+    uint32_t FgAddress;     /* Foreground (source) address                            */
+    uint32_t FgOffset;      /* Foreground line offset in pixels                       */
+    uint32_t FgColorMode;   /* Foreground color mode (e.g. DMA2D_INPUT_RGB565)        */
+    uint32_t FgAlphaMode;   /* DMA2D_NO_MODIF_ALPHA, DMA2D_REPLACE_ALPHA, ...         */
+    uint32_t FgAlpha;       /* Foreground alpha, ARGB8888 color for A8 and A4 inputs  */
+    uint32_t FgRedBlueSwap; /* DMA2D_RB_REGULAR or DMA2D_RB_SWAP                      */
+    const uint32_t *FgClut; /* ARGB8888 CLUT of L8/AL88 (256) or L4/AL44 (16) inputs  */
+    uint32_t BgAddress;     /* Background address (blending only)                     */
+    uint32_t BgOffset;      /* Background line offset in pixels                       */
+    uint32_t BgColorMode;   /* Background color mode                                  */
+    uint32_t OutAddress;    /* Output address                                         */
+    uint32_t OutOffset;     /* Output line offset in pixels                           */
+    uint32_t OutColorMode;  /* Output color mode (e.g. DMA2D_OUTPUT_ARGB8888)         */
+    uint32_t OutColor;      /* ARGB8888 fill color (register to memory only)          */
+    uint16_t Width;         /* Width in pixels                                        */
+    uint16_t Height;        /* Height in lines                                        */
+  } DMA2D_Job_t;
+
   /* Protoypes */
 
   uint8_t *get_lcd_frame_write_buff(void);
   void LCD_Init(void);
   int DisplayWelcomeScreen(void);
   void LCD_Refresh(void);
+  int LCD_WriteBufferReady(void);
+  void LCD_AddDirtyRect(uint16_t x, uint16_t y, uint16_t xsize, uint16_t ysize);
+  void LCD_WillOverwriteRect(uint16_t x, uint16_t y, uint16_t xsize, uint16_t ysize);
+#if LCD_CAMERA_LAYER_MODE
+  void LCD_CameraLayerInit(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+  DMA2D_Fence_t LCD_CameraLayerWriteGray(const uint8_t *pGray);
+#endif
   void LCD_DMA2D2LCDWriteBuffer(uint32_t *pSrc, uint16_t x, uint16_t y,
                                 uint16_t xsize, uint16_t ysize,
-                                uint32_t input_color_format, int red_blue_swap);
+                                uint32_t input_color_format, int red_blue_swap,
+                                const uint32_t *pClut);
+  void LCD_DMA2D2LCDWriteImage(Image_t *img, uint16_t x, uint16_t y, imgpalette_t palette);
   void DMA2D_MEMCOPY(uint32_t *pSrc, uint32_t *pDst, uint16_t x, uint16_t y,
                      uint16_t xsize, uint16_t ysize, uint32_t rowStride,
                      uint32_t input_color_format, uint32_t output_color_format,
-                     int pfc, int red_blue_swap);
+                     int pfc, int red_blue_swap, const uint32_t *pClut);
+  const uint32_t *DMA2D_GetPalette(imgpalette_t palette);
+  DMA2D_Fence_t DMA2D_QueueSubmit(const DMA2D_Job_t *job);
+  DMA2D_Fence_t DMA2D_QueueCopy(uint32_t *pSrc, uint32_t *pDst, uint16_t x, uint16_t y,
+                                uint16_t xsize, uint16_t ysize, uint32_t rowStride,
+                                uint32_t input_color_format, uint32_t output_color_format,
+                                int pfc, int red_blue_swap, const uint32_t *pClut);
+  DMA2D_Fence_t DMA2D_QueueFill(uint32_t *pDst, uint16_t x, uint16_t y, uint16_t xsize,
+                                uint16_t ysize, uint32_t rowStride,
+                                uint32_t output_color_format, uint32_t color);
+  DMA2D_Fence_t DMA2D_QueueBlend(uint32_t *pFg, uint32_t fg_color_format, uint32_t fg_alpha,
+                                 uint32_t *pDst, uint16_t x, uint16_t y, uint16_t xsize,
+                                 uint16_t ysize, uint32_t rowStride,
+                                 uint32_t output_color_format);
+  DMA2D_Fence_t DMA2D_QueueLastFence(void);
+  int DMA2D_FenceDone(DMA2D_Fence_t fence);
+  void DMA2D_FenceWait(DMA2D_Fence_t fence);
+  uint32_t DMA2D_QueueGetErrors(void);
+  uint64_t DMA2D_QueueGetBusyCycles(void);
+  void DMA2D_QueueResume(void);
+  void LCD_DMA2D_IRQHandler(void);
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -5,7 +5,11 @@
 #include <stdio.h>
 
 #include "display.h"
+#include "scheduler.h"
+#include "stats.h"
+#include "uart_tx.h"
 #include "stm32_img.h"
+#include "stm32_img_bench.h"
 
 #include "microtrace.h"
 
@@ -20,6 +24,13 @@
 /*Defines related to cache settings*/
 #define EXT_SDRAM_CACHE_ENABLED 1
 
+/* USART1 (printf) transmit DMA */
+#define UART_TX_DMA_STREAM DMA1_Stream7
+#define UART_TX_DMA_IRQn DMA1_Stream7_IRQn
+#define UART_TX_DMA_IRQHandler DMA1_Stream7_IRQHandler
+
+extern UART_HandleTypeDef huart1;
+
 #define LCD_BRIGHTNESS_MIN 0
 #define LCD_BRIGHTNESS_MAX 100
 #define LCD_BRIGHTNESS_MID 50
@@ -34,17 +34,37 @@
 /* ====== Configuration ========== */
 /* =============================== */
 
-/* Uncomment the following to disable Microtrace */
+/* Microtrace is disabled unless MICROTRACE_ENABLE is defined (here or with
+ * -DMICROTRACE_ENABLE) */
+#if !defined(MICROTRACE_ENABLE) && !defined(MICROTRACE_DISABLE)
 #define MICROTRACE_DISABLE
+#endif
+
+/* Define MICROTRACE_RING (here or with -DMICROTRACE_RING) for the ring
+ * buffer mode: events can be recorded from any context, interrupts included,
+ * into a ring of MICROTRACE_MAX_EVENTS records which MICROTRACE_STREAM_POLL()
+ * streams continuously in the background through microtrace_stream_write()
+ * (see below). Events recorded while the ring is full are dropped and
+ * counted instead of halting */
+/* #define MICROTRACE_RING */
 
 /* Maximum number of events to be recorded. Microtrace will stop after max
- * events is reached and start to jump the JSON report. A big number of event
- * can take a lot of space in RAM */
-#define MICROTRACE_MAX_EVENTS (1000)
+ * events is reached and dump its buffer (MICROTRACE_DUMP). Each event takes
+ * 8 bytes: 9216 events fit in 72 KB, 131072 events in 1 MB of external
+ * memory (see MICROTRACE_CUSTOM_MEMORY). In ring mode, the ring size (a power
+ * of 2) */
+#ifdef MICROTRACE_RING
+#define MICROTRACE_MAX_EVENTS (8192)
+#else
+#define MICROTRACE_MAX_EVENTS (9216)
+#endif
+
+/* Ring mode stream buffer size, in bytes (multiple of 32) */
+#define MICROTRACE_STREAM_BUFFER_SIZE (1024)
 
 /* Maximum number of characters for the `Category` or `Name` string
- * if an string lenght exceeded this number the compilation will fail
- * Note that reducing this value improves memory footprint */
+ * if an string lenght exceeded this number the compilation will fail.
+ * Strings are interned, only the dump lines depend on this value */
 #define MICROTRACE_MAX_STRING_LEN (32)
 
 /* Uncomment the followint if you want to place
@@ -53,9 +73,24 @@
 /* #define MICROTRACE_CUSTOM_MEMORY */
 
 /* Memory section to place microtrace buffer.
- * (it can be usefull to use external memory if avaible. e.g ".ext_sdram"
+ * (it can be usefull to use external memory if avaible. e.g ".microtrace",
+ * in the SDRAM: the first event must then follow the SDRAM initialization)
  * Warning MICROTRACE_CUSTOM_MEMORY should be defined */
-#define MICROTRACE_BUFFER_SECTION ""
+#define MICROTRACE_BUFFER_SECTION ".microtrace"
+
+/* Timestamp source:
+ * - MICROTRACE_CLOCK_DWT: Cortex-M DWT cycle counter (CYCCNT), converted to
+ *   nanoseconds with SystemCoreClock. The 32-bit counter wraps around every
+ *   10 s at 400 MHz: at least one event must be recorded per wrap period, and
+ *   the core clock must not change while tracing.
+ * - MICROTRACE_CLOCK_COUNT_FUNCTION: MICROTRACE_COUNT_FUNCTION times
+ *   MICROTRACE_MULTIPLIER, in microseconds (e.g. HAL_GetTick, 1 ms
+ *   resolution) */
+#define MICROTRACE_CLOCK_COUNT_FUNCTION 0
+#define MICROTRACE_CLOCK_DWT 1
+#ifndef MICROTRACE_CLOCK
+#define MICROTRACE_CLOCK MICROTRACE_CLOCK_DWT
+#endif
 
 /* Function used to get number of microseconds elapsed since begining of
  * program. e.g HAL_GetTick */
@@ -68,34 +103,375 @@
 
 /* =============================== */
 
+#define MICROTRACE_STATIC_ASSERT(COND, MSG)                                    \
+  typedef char MICROTRACE_STATIC_ASSERTION_FAILED_##MSG[(COND) ? 1 : -1]
+
+/* Interned event name: one per call site, placed in the .microtrace_names
+ * section (see the linker script). The event ID is its index in the
+ * section, which is the name table of the dump */
 typedef struct
 {
-  char category[MICROTRACE_MAX_STRING_LEN];
-  char name[MICROTRACE_MAX_STRING_LEN];
-  uint32_t timestamp;
-  char phase;
+  const char *category;
+  const char *name;
+} microtrace_name_t;
+
+/* Event record */
+typedef struct
+{
+  uint32_t timestamp; /* Clock count (cycles or microseconds), bits 0..31 */
+  uint16_t id;        /* Name index in the name table                    */
+  uint8_t phase;      /* 'B', 'E' or 'I'                                 */
+  uint8_t wrap;       /* Clock count, bits 32..39                        */
 } microtrace_event_t;
 
+MICROTRACE_STATIC_ASSERT(sizeof(microtrace_event_t) == 8,
+                         EVENT_RECORD_IS_NOT_8_BYTES);
+
+#ifdef MICROTRACE_RING
+MICROTRACE_STATIC_ASSERT((MICROTRACE_MAX_EVENTS &
+                          (MICROTRACE_MAX_EVENTS - 1)) == 0,
+                         RING_SIZE_IS_NOT_A_POWER_OF_2);
+#endif
+
 extern microtrace_event_t microtrace_event_buffer[MICROTRACE_MAX_EVENTS];
 extern uint32_t microtrace_event_counter;
 extern char microtrace_print_buffer[512];
+extern uint32_t microtrace_clock_last;
+extern uint32_t microtrace_clock_wraps;
+extern const microtrace_name_t __microtrace_names_start[];
+extern const microtrace_name_t __microtrace_names_end[];
 
-#define MICROTRACE_STATIC_ASSERT(COND, MSG)                                    \
-  typedef char MICROTRACE_STATIC_ASSERTION_FAILED_##MSG[(COND) ? 1 : -1]
+/* Ring mode state: records reserved by the producers and records streamed,
+ * as free-running counts, events dropped, and stream progress */
+extern volatile uint32_t microtrace_ring_head;
+extern volatile uint32_t microtrace_ring_tail;
+extern volatile uint32_t microtrace_ring_dropped;
+extern char microtrace_stream_buffer[MICROTRACE_STREAM_BUFFER_SIZE];
+extern volatile uint32_t microtrace_stream_busy;
+extern uint32_t microtrace_stream_pending;
+extern uint32_t microtrace_stream_names;
+extern uint32_t microtrace_stream_dropped;
 
+/* Ring mode output, provided by the application: starts sending size bytes
+ * at pData in the background (e.g. UART DMA transfer) and returns 1, or
+ * returns 0 if the output is busy. The data must stay untouched until
+ * MICROTRACE_STREAM_DONE() is called, on completion of the transfer */
+int microtrace_stream_write(const char *pData, uint32_t size);
+
+/* The definitions are weak so that every source file including this header
+ * shares them */
 #ifndef MICROTRACE_DISABLE
 #ifndef MICROTRACE_BUFFER_HAS_BEEN_ALLOCATED
 #define MICROTRACE_BUFFER_HAS_BEEN_ALLOCATED
 #ifdef MICROTRACE_CUSTOM_MEMORY
 __attribute__((section(MICROTRACE_BUFFER_SECTION)))
 #endif
+__attribute__((weak))
 microtrace_event_t microtrace_event_buffer[MICROTRACE_MAX_EVENTS];
-uint32_t microtrace_event_counter;
-#ifdef MICROTRACE_CUSTOM_MEMORY
-__attribute__((section(MICROTRACE_BUFFER_SECTION)))
+__attribute__((weak)) uint32_t microtrace_event_counter;
+__attribute__((weak)) char microtrace_print_buffer[512];
+__attribute__((weak)) uint32_t microtrace_clock_last;
+__attribute__((weak)) uint32_t microtrace_clock_wraps;
+#ifdef MICROTRACE_RING
+__attribute__((weak)) volatile uint32_t microtrace_ring_head;
+__attribute__((weak)) volatile uint32_t microtrace_ring_tail;
+__attribute__((weak)) volatile uint32_t microtrace_ring_dropped;
+__attribute__((weak, aligned(32)))
+char microtrace_stream_buffer[MICROTRACE_STREAM_BUFFER_SIZE];
+__attribute__((weak)) volatile uint32_t microtrace_stream_busy;
+__attribute__((weak)) uint32_t microtrace_stream_pending;
+__attribute__((weak)) uint32_t microtrace_stream_names;
+__attribute__((weak)) uint32_t microtrace_stream_dropped;
+#endif
+#endif
+#endif
+
+#ifndef MICROTRACE_DISABLE
+/* Starts the timestamp source, if not running yet */
+static inline void microtrace_init(void)
+{
+#if MICROTRACE_CLOCK == MICROTRACE_CLOCK_DWT
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7)
+    DWT->LAR = 0xC5ACCE55; /* Cortex-M7 DWT software lock */
+#endif
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+  microtrace_clock_last = DWT->CYCCNT;
+#endif
+}
+
+/* Returns the clock count, wrapping around */
+static inline uint32_t microtrace_clock(void)
+{
+#if MICROTRACE_CLOCK == MICROTRACE_CLOCK_DWT
+  return DWT->CYCCNT;
+#else
+  return MICROTRACE_COUNT_FUNCTION() * MICROTRACE_MULTIPLIER;
+#endif
+}
+
+/* Returns the clock frequency */
+static inline uint32_t microtrace_clock_hz(void)
+{
+#if MICROTRACE_CLOCK == MICROTRACE_CLOCK_DWT
+  return SystemCoreClock;
+#else
+  return 1000000u;
+#endif
+}
+
+/* Records an event. The wrap arounds of the clock between two events extend
+ * it to 40 bits in the record */
+static inline void microtrace_add_event(char phase,
+                                        const microtrace_name_t *name)
+{
+  const uint32_t now = microtrace_clock();
+  microtrace_event_t *event =
+      &microtrace_event_buffer[microtrace_event_counter++];
+
+  if (now < microtrace_clock_last) {
+    microtrace_clock_wraps++;
+  }
+  microtrace_clock_last = now;
+  event->timestamp = now;
+  event->id = (uint16_t)(name - __microtrace_names_start);
+  event->phase = (uint8_t)phase;
+  event->wrap = (uint8_t)microtrace_clock_wraps;
+}
+
+#ifdef MICROTRACE_RING
+/* Increments a counter shared with other contexts */
+static inline void microtrace_atomic_inc(volatile uint32_t *counter)
+{
+#if (__CORTEX_M >= 3U)
+  uint32_t value;
+
+  do {
+    value = __LDREXW(counter);
+  } while (__STREXW(value + 1, counter) != 0);
+#else
+  const uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  (*counter)++;
+  __set_PRIMASK(primask);
+#endif
+}
+
+/* Records an event in the ring, from any context. A record is reserved by
+ * an exclusive (LDREX/STREX) increment of the head, the clock being read
+ * within the exclusive access: an interrupt in between makes the store fail
+ * and the reservation start over, so that the records are in time order.
+ * The phase, written last, commits the record to the streamer. The wrap
+ * field is filled by the streamer */
+static inline void microtrace_ring_add_event(char phase,
+                                             const microtrace_name_t *name)
+{
+  microtrace_event_t *event;
+  uint32_t head;
+  uint32_t now;
+
+#if (__CORTEX_M >= 3U)
+  do {
+    head = __LDREXW(&microtrace_ring_head);
+    now = microtrace_clock();
+    if (head - microtrace_ring_tail >= MICROTRACE_MAX_EVENTS) {
+      __CLREX();
+      microtrace_atomic_inc(&microtrace_ring_dropped);
+      return;
+    }
+  } while (__STREXW(head + 1, &microtrace_ring_head) != 0);
+#else
+  const uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  head = microtrace_ring_head;
+  now = microtrace_clock();
+  if (head - microtrace_ring_tail >= MICROTRACE_MAX_EVENTS) {
+    microtrace_ring_dropped++;
+    __set_PRIMASK(primask);
+    return;
+  }
+  microtrace_ring_head = head + 1;
+  __set_PRIMASK(primask);
+#endif
+
+  event = &microtrace_event_buffer[head & (MICROTRACE_MAX_EVENTS - 1)];
+  event->timestamp = now;
+  event->id = (uint16_t)(name - __microtrace_names_start);
+  event->wrap = 0;
+  __DMB();
+  *(volatile uint8_t *)&event->phase = (uint8_t)phase;
+}
+
+/* Fills the stream buffer with the next lines of the compact dump format
+ * (see MICROTRACE_DUMP): the header and name table once, a drop count line
+ * whenever it changes, then the committed records, freeing their slots.
+ * Returns the number of bytes written */
+static inline uint32_t microtrace_stream_fill(char *buffer, uint32_t size)
+{
+  const uint32_t line_max = 160;
+  const uint32_t names = __microtrace_names_end - __microtrace_names_start;
+  const uint32_t dropped = microtrace_ring_dropped;
+  uint32_t len = 0;
+
+  for (; (microtrace_stream_names <= names) && (size - len >= line_max);
+       microtrace_stream_names++) {
+    if (microtrace_stream_names == 0) {
+      /* No event count: a stream lasts until the end of the capture */
+      len += sprintf(buffer + len, "#MT %lu %lu 0\r\n",
+                     (unsigned long)microtrace_clock_hz(),
+                     (unsigned long)names);
+    } else {
+      const microtrace_name_t *name =
+          &__microtrace_names_start[microtrace_stream_names - 1];
+      len += sprintf(buffer + len, "#MTN %lu\t%s\t%s\r\n",
+                     (unsigned long)(microtrace_stream_names - 1),
+                     name->category, name->name);
+    }
+  }
+  if (microtrace_stream_names <= names) {
+    return len;
+  }
+
+  if ((dropped != microtrace_stream_dropped) && (size - len >= line_max)) {
+    len += sprintf(buffer + len, "#MTD %lu\r\n", (unsigned long)dropped);
+    microtrace_stream_dropped = dropped;
+  }
+
+  while (size - len >= line_max) {
+    char *line = buffer + len;
+    uint32_t n;
+
+    for (n = 0; n < 8; n++) {
+      microtrace_event_t *slot =
+          &microtrace_event_buffer[microtrace_ring_tail &
+                                   (MICROTRACE_MAX_EVENTS - 1)];
+      microtrace_event_t event;
+
+      if (*(volatile uint8_t *)&slot->phase == 0) {
+        break; /* Empty, or reserved but not committed yet */
+      }
+      __DMB();
+      event = *slot;
+      slot->phase = 0;
+      __DMB();
+      microtrace_ring_tail++;
+
+      /* Same wrap tracking as the linear buffer, in record order */
+      if (event.timestamp < microtrace_clock_last) {
+        microtrace_clock_wraps++;
+      }
+      microtrace_clock_last = event.timestamp;
+
+      if (n == 0) {
+        line += sprintf(line, "#MTE");
+      }
+      line += sprintf(line, " %08lx%04x%02x%02x",
+                      (unsigned long)event.timestamp, event.id, event.phase,
+                      (uint8_t)microtrace_clock_wraps);
+    }
+    if (n == 0) {
+      break;
+    }
+    line += sprintf(line, "\r\n");
+    len = line - buffer;
+    if (n < 8) {
+      break;
+    }
+  }
+  return len;
+}
+
+/* Sends the pending stream data, if the output is idle, refilling it first
+ * once sent. To be called from the idle loop, and from the transfer
+ * completion (after microtrace_stream_done()) to chain the transfers: both
+ * never run concurrently, the completion only occurring while busy */
+static inline void microtrace_stream_poll(void)
+{
+  if (microtrace_stream_busy) {
+    return;
+  }
+  if (microtrace_stream_pending == 0) {
+    microtrace_stream_pending = microtrace_stream_fill(
+        microtrace_stream_buffer, sizeof(microtrace_stream_buffer));
+  }
+  if (microtrace_stream_pending != 0) {
+    /* Busy before starting, the transfer may complete within the call */
+    microtrace_stream_busy = 1;
+    if (!microtrace_stream_write(microtrace_stream_buffer,
+                                 microtrace_stream_pending)) {
+      microtrace_stream_busy = 0;
+    }
+  }
+}
+
+/* Transfer completion: frees the stream buffer */
+static inline void microtrace_stream_done(void)
+{
+  microtrace_stream_pending = 0;
+  microtrace_stream_busy = 0;
+}
 #endif
-char microtrace_print_buffer[512];
+
+/* Converts a clock count to nanoseconds */
+static inline uint64_t microtrace_timestamp_to_ns(uint64_t timestamp)
+{
+  const uint32_t hz = microtrace_clock_hz();
+
+  /* Split to keep the products within 64 bits */
+  return (timestamp / hz) * 1000000000u +
+         ((timestamp % hz) * 1000000000u) / hz;
+}
+
+/* Formats a clock count as microseconds with 3 decimals (Chrome tracing
+ * "ts"), without 64-bit printf support (newlib-nano) */
+static inline char *microtrace_format_ts(char *buffer, uint64_t timestamp)
+{
+  const uint64_t ns = microtrace_timestamp_to_ns(timestamp);
+  const uint64_t us = ns / 1000u;
+
+  if ((us >> 32) != 0) {
+    sprintf(buffer, "%lu%09lu.%03lu", (unsigned long)(us / 1000000000u),
+            (unsigned long)(us % 1000000000u), (unsigned long)(ns % 1000u));
+  } else {
+    sprintf(buffer, "%lu.%03lu", (unsigned long)us,
+            (unsigned long)(ns % 1000u));
+  }
+  return buffer;
+}
+
+/* Returns the clock count of an event, from its 40-bit record and the
+ * previous event: the 8-bit wrap field itself wraps around every 256 clock
+ * wraps */
+static inline uint64_t microtrace_event_time(const microtrace_event_t *event,
+                                             uint64_t previous)
+{
+  uint64_t time = (previous & ~0xFFFFFFFFFFull) |
+                  ((uint64_t)event->wrap << 32) | event->timestamp;
+
+  if (time < previous) {
+    time += 1ull << 40;
+  }
+  return time;
+}
 #endif
+
+#ifdef MICROTRACE_RING
+#define _MICROTRACE_RECORD(_phase, _name) microtrace_ring_add_event(_phase, _name)
+#else
+#define _MICROTRACE_RECORD(_phase, _name)                                      \
+  do {                                                                         \
+    if (microtrace_event_counter >= MICROTRACE_MAX_EVENTS) {                   \
+      MICROTRACE_DUMP();                                                       \
+      while (1) {                                                              \
+      };                                                                       \
+    }                                                                          \
+    microtrace_add_event(_phase, _name);                                       \
+  } while (0)
 #endif
 
 #ifndef MICROTRACE_DISABLE
@@ -105,19 +481,10 @@ char microtrace_print_buffer[512];
                              CATEGORY_STRING_LENGHT_TOO_BIG);                  \
     MICROTRACE_STATIC_ASSERT(sizeof(_name) < MICROTRACE_MAX_STRING_LEN,        \
                              NAME_STRING_LENGHT_LENGHT_TOO_BIG);               \
-    if (microtrace_event_counter >= MICROTRACE_MAX_EVENTS) {                   \
-      MICROTRACE_DUMP_JSON();                                                  \
-      while (1) {                                                              \
-      };                                                                       \
-    }                                                                          \
-    uint32_t timestamp = MICROTRACE_COUNT_FUNCTION();                          \
-    microtrace_event_t *event =                                                \
-        &microtrace_event_buffer[microtrace_event_counter];                    \
-    microtrace_event_counter++;                                                \
-    strcpy(event->category, _category);                                        \
-    strcpy(event->name, _name);                                                \
-    event->timestamp = timestamp;                                              \
-    event->phase = _phase;                                                     \
+    static const microtrace_name_t microtrace_name                             \
+        __attribute__((section(".microtrace_names"), used)) = {"" _category,   \
+                                                               "" _name};      \
+    _MICROTRACE_RECORD(_phase, &microtrace_name);                              \
   } while (0);
 #else
 #define _MICROTRACE_ADD_EVENT(_phase, _category, _name)                        \
@@ -125,29 +492,66 @@ char microtrace_print_buffer[512];
   } while (0)
 #endif
 
-#ifndef MICROTRACE_DISABLE
+/* Compact dump, expanded to Chrome JSON on the host by microtrace_decode
+ * (Utilities/Microtrace). Text lines, so that it can be captured from a
+ * serial terminal among other output:
+ *   #MT <clock_hz> <names> <events>
+ *   #MTN <id>\t<category>\t<name>        (one per name)
+ *   #MTE <record>...                     (up to 8 records per line)
+ *   #MTEND
+ * Each record is 16 hex digits: timestamp (8), id (4), phase (2), wrap (2).
+ * The ring mode streams the same lines, without event count nor end line,
+ * plus "#MTD <dropped>" lines. The dumps are no-ops in ring mode */
+#if !defined(MICROTRACE_DISABLE) && !defined(MICROTRACE_RING)
+#define MICROTRACE_DUMP()                                                      \
+  do {                                                                         \
+    const uint32_t names = __microtrace_names_end - __microtrace_names_start;  \
+    printf("#MT %lu %lu %lu\r\n", (unsigned long)microtrace_clock_hz(),        \
+           (unsigned long)names, (unsigned long)microtrace_event_counter);     \
+    for (uint32_t i = 0; i < names; i++) {                                     \
+      printf("#MTN %lu\t%s\t%s\r\n", (unsigned long)i,                         \
+             __microtrace_names_start[i].category,                             \
+             __microtrace_names_start[i].name);                                \
+    }                                                                          \
+    for (uint32_t i = 0; i < microtrace_event_counter; i += 8) {               \
+      char *line = microtrace_print_buffer;                                    \
+      line += sprintf(line, "#MTE");                                           \
+      for (uint32_t j = i; (j < i + 8) && (j < microtrace_event_counter);      \
+           j++) {                                                              \
+        const microtrace_event_t *event = &microtrace_event_buffer[j];         \
+        line += sprintf(line, " %08lx%04x%02x%02x",                            \
+                        (unsigned long)event->timestamp, event->id,            \
+                        event->phase, event->wrap);                            \
+      }                                                                        \
+      printf("%s\r\n", microtrace_print_buffer);                               \
+    }                                                                          \
+    printf("#MTEND\r\n");                                                      \
+  } while (0)
+#else
+#define MICROTRACE_DUMP()                                                      \
+  do {                                                                         \
+  } while (0)
+#endif
+
+/* Chrome JSON dump, expanded on the target (slow for large buffers) */
+#if !defined(MICROTRACE_DISABLE) && !defined(MICROTRACE_RING)
 #define MICROTRACE_DUMP_JSON()                                                 \
   do {                                                                         \
+    char ts[24];                                                               \
+    uint64_t time = 0;                                                         \
     printf("{\"traceEvents\":[\r\n");                                          \
-    for (uint32_t i = 0; i < microtrace_event_counter - 1; i++) {              \
+    for (uint32_t i = 0; i < microtrace_event_counter; i++) {                  \
+      const microtrace_event_t *event = &microtrace_event_buffer[i];           \
+      const microtrace_name_t *name = &__microtrace_names_start[event->id];    \
+      time = microtrace_event_time(event, time);                               \
       sprintf(microtrace_print_buffer,                                         \
-              "{\"cat\":\"%s\",\"pid\":1,\"tid\":1,\"ts\":%ld,\"ph\":\"%c\","  \
-              "\"name\":\"%s\",\"args\":{}},\r\n",                             \
-              microtrace_event_buffer[i].category,                             \
-              microtrace_event_buffer[i].timestamp *MICROTRACE_MULTIPLIER,     \
-              microtrace_event_buffer[i].phase,                                \
-              microtrace_event_buffer[i].name);                                \
-      printf(microtrace_print_buffer);                                         \
+              "{\"cat\":\"%s\",\"pid\":1,\"tid\":1,\"ts\":%s,\"ph\":\"%c\","   \
+              "\"name\":\"%s\",\"args\":{}}%s\r\n",                            \
+              name->category, microtrace_format_ts(ts, time), event->phase,    \
+              name->name, (i + 1 < microtrace_event_counter) ? "," : "");      \
+      printf("%s", microtrace_print_buffer);                                   \
     }                                                                          \
-    sprintf(microtrace_print_buffer,                                           \
-            "{\"cat\":\"%s\",\"pid\":1,\"tid\":1,\"ts\":%ld,\"ph\":\"%c\","    \
-            "\"name\":\"%s\",\"args\":{}}]}\r\n",                              \
-            microtrace_event_buffer[microtrace_event_counter - 1].category,    \
-            microtrace_event_buffer[microtrace_event_counter - 1]              \
-                .timestamp *MICROTRACE_MULTIPLIER,                             \
-            microtrace_event_buffer[microtrace_event_counter - 1].phase,       \
-            microtrace_event_buffer[microtrace_event_counter - 1].name);       \
-    printf(microtrace_print_buffer);                                           \
+    printf("],\"displayTimeUnit\":\"ns\"}\r\n");                               \
   } while (0)
 #else
 #define MICROTRACE_DUMP_JSON()                                                 \
@@ -155,6 +559,29 @@ char microtrace_print_buffer[512];
   } while (0)
 #endif
 
+#ifndef MICROTRACE_DISABLE
+#define MICROTRACE_INIT() microtrace_init()
+#else
+#define MICROTRACE_INIT()                                                      \
+  do {                                                                         \
+  } while (0)
+#endif
+
+/* Ring mode streaming: MICROTRACE_STREAM_POLL() from the idle loop, and
+ * MICROTRACE_STREAM_DONE() then MICROTRACE_STREAM_POLL() from the output
+ * transfer completion */
+#if !defined(MICROTRACE_DISABLE) && defined(MICROTRACE_RING)
+#define MICROTRACE_STREAM_POLL() microtrace_stream_poll()
+#define MICROTRACE_STREAM_DONE() microtrace_stream_done()
+#else
+#define MICROTRACE_STREAM_POLL()                                               \
+  do {                                                                         \
+  } while (0)
+#define MICROTRACE_STREAM_DONE()                                               \
+  do {                                                                         \
+  } while (0)
+#endif
+
 #define MICROTRACE_BEGIN(cat, name) _MICROTRACE_ADD_EVENT('B', cat, name)
 #define MICROTRACE_END(cat, name) _MICROTRACE_ADD_EVENT('E', cat, name)
 #define MICROTRACE_INSTANT(cat, name) _MICROTRACE_ADD_EVENT('I', cat, name)
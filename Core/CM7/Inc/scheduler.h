@@ -0,0 +1,71 @@
+/**
+ ******************************************************************************
+ * @file    scheduler.h
+ * @brief   Frame scheduler: cycle counter timestamps of the camera, display
+ *          and pipeline stage events, frame drop / display skip decisions and
+ *          frame time budget accounting
+ ******************************************************************************
+ */
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+/* Largest number of consecutive display updates skipped, and of consecutive
+ * stale frames dropped */
+#ifndef SCHED_MAX_DISPLAY_SKIPS
+#define SCHED_MAX_DISPLAY_SKIPS 2
+#endif
+#ifndef SCHED_MAX_STALE_DROPS
+#define SCHED_MAX_STALE_DROPS 1
+#endif
+
+  /* Pipeline stages of a frame */
+  typedef enum
+  {
+    SCHED_STAGE_ACQUIRE, /* Waiting for the camera frame         */
+    SCHED_STAGE_CONVERT, /* Image processing and conversion      */
+    SCHED_STAGE_DISPLAY, /* Drawing and LCD refresh              */
+    SCHED_STAGE_COUNT
+  } SCHED_Stage_t;
+
+  /* Cycle statistics of a stage (or of whole frames) */
+  typedef struct
+  {
+    uint32_t Count;    /* Completed runs                            */
+    uint32_t Last;     /* Duration of the last run, in cycles       */
+    uint32_t Max;      /* Longest run, in cycles                    */
+    uint64_t Total;    /* Sum of the run durations, in cycles       */
+    uint32_t Budget;   /* Budget in cycles, 0 if none               */
+    uint32_t Overruns; /* Runs longer than the budget               */
+  } SCHED_Stats_t;
+
+  /* Protoypes */
+
+  void SCHED_Init(void);
+  uint32_t SCHED_Now(void);
+  uint32_t SCHED_CyclesToUs(uint32_t cycles);
+  void SCHED_SetBudget(SCHED_Stage_t stage, uint32_t us);
+  void SCHED_SetFrameBudget(uint32_t us);
+  uint32_t SCHED_FrameStart(void);
+  int SCHED_FrameIsStale(void);
+  uint32_t SCHED_StageBegin(SCHED_Stage_t stage);
+  uint32_t SCHED_StageEnd(SCHED_Stage_t stage);
+  int SCHED_ShouldDisplay(void);
+  uint32_t SCHED_FrameEnd(int displayed);
+  float SCHED_GetDisplayRate(void);
+  const SCHED_Stats_t *SCHED_GetStats(SCHED_Stage_t stage);
+  void SCHED_Report(void);
+  void SCHED_CameraFrameEvent(void);
+  void SCHED_VblankEvent(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* SCHEDULER_H */
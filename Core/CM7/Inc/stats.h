@@ -0,0 +1,75 @@
+/**
+ ******************************************************************************
+ * @file    stats.h
+ * @brief   Performance counters: per-stage cycle histograms (min / avg / max /
+ *          p99) from the scheduler timestamps, camera and DMA2D counters,
+ *          periodic JSON report on the UART (with the scheduler statistics)
+ *          and optional on-screen overlay
+ ******************************************************************************
+ */
+#ifndef STATS_H
+#define STATS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+/* Frames between two STATS_Report() calls from STATS_FrameEnd(), 0 for none */
+#ifndef STATS_REPORT_FRAMES
+#define STATS_REPORT_FRAMES 300
+#endif
+
+/* Whether the overlay is drawn at startup, see STATS_SetOverlay() */
+#ifndef STATS_OVERLAY
+#define STATS_OVERLAY 0
+#endif
+
+/* Histogram resolution: sub-buckets per power of 2, a power of 2. Percentiles
+ * are bucket upper bounds, overestimated by at most 1 / STATS_HIST_SUB_BUCKETS. */
+#ifndef STATS_HIST_SUB_BUCKETS
+#define STATS_HIST_SUB_BUCKETS 8
+#endif
+
+  /* Measured stages of a frame */
+  typedef enum
+  {
+    STATS_STAGE_CAPTURE_WAIT, /* Waiting for the camera frame          */
+    STATS_STAGE_CONVERT,      /* Pixel format conversion               */
+    STATS_STAGE_RESIZE,       /* Scaling, unless done by another stage */
+    STATS_STAGE_BLIT,         /* Copy of the image to the LCD          */
+    STATS_STAGE_REFRESH,      /* LCD refresh (page flip)               */
+    STATS_STAGE_OVERLAY,      /* Text drawn over the image             */
+    STATS_STAGE_FRAME,        /* Whole frame, from STATS_FrameStart()  */
+    STATS_STAGE_COUNT
+  } STATS_Stage_t;
+
+  /* Summary of a stage histogram, in cycles */
+  typedef struct
+  {
+    uint32_t Count; /* Runs                              */
+    uint32_t Min;   /* Shortest run, 0 if none           */
+    uint32_t Avg;   /* Average run                       */
+    uint32_t Max;   /* Longest run                       */
+    uint32_t P99;   /* 99th percentile                   */
+  } STATS_Summary_t;
+
+  /* Protoypes */
+
+  void STATS_Init(void);
+  void STATS_FrameStart(uint32_t now);
+  void STATS_StageBegin(STATS_Stage_t stage, uint32_t now);
+  void STATS_StageEnd(STATS_Stage_t stage, uint32_t now);
+  void STATS_FrameEnd(int displayed, uint32_t now);
+  void STATS_GetSummary(STATS_Stage_t stage, STATS_Summary_t *summary);
+  void STATS_Report(void);
+  void STATS_SetOverlay(int enable);
+  void STATS_DrawOverlay(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* STATS_H */
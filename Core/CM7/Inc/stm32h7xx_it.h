@@ -44,6 +44,8 @@ void BSP_CAMERA_DMA_IRQHandler(void);
 void BSP_CAMERA_IRQHandler(void);
 void DSI_IRQHandler(void);
 void DMA2D_IRQHandler(void);
+void UART_TX_DMA_IRQHandler(void);
+void USART1_IRQHandler(void);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,55 @@
+/**
+ ******************************************************************************
+ * @file    uart_tx.h
+ * @brief   Non-blocking UART output: ring buffer drained by DMA in the
+ *          background, behind _write() / printf()
+ ******************************************************************************
+ */
+#ifndef UART_TX_H
+#define UART_TX_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "stm32h7xx_hal.h"
+
+/* USART1 baud rate (the ST-LINK virtual COM port supports up to 2 Mbit/s) */
+#ifndef UART_TX_BAUDRATE
+#define UART_TX_BAUDRATE 921600
+#endif
+
+/* Size of the transmit ring buffer in bytes, a power of 2 up to 32768 */
+#ifndef UART_TX_RING_SIZE
+#define UART_TX_RING_SIZE 4096
+#endif
+
+/* Overflow policy at startup, see UART_TX_Policy_t */
+#ifndef UART_TX_POLICY
+#define UART_TX_POLICY UART_TX_DROP
+#endif
+
+  /* What to do with output that does not fit in the ring buffer */
+  typedef enum
+  {
+    UART_TX_DROP,      /* Drop the new bytes that do not fit              */
+    UART_TX_OVERWRITE, /* Drop old bytes if DMA idle, else UART_TX_DROP   */
+    UART_TX_BLOCK      /* Wait for room, UART_TX_DROP in interrupts       */
+  } UART_TX_Policy_t;
+
+  /* Protoypes */
+
+  void UART_TX_Init(UART_HandleTypeDef *huart);
+  void UART_TX_SetPolicy(UART_TX_Policy_t policy);
+  uint32_t UART_TX_Write(const void *pData, uint32_t size);
+  uint32_t UART_TX_GetFree(void);
+  uint32_t UART_TX_GetDropped(void);
+  void UART_TX_Flush(void);
+  void UART_TX_CpltCallback(UART_HandleTypeDef *huart);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* UART_TX_H */
@@ -37,18 +37,136 @@ __attribute__((section(".Lcd_Display")))
 #else
 #error Unknown compiler
 #endif
-uint8_t lcd_display_global_memory[LCD_FRAME_BUFFER_SIZE * 2];
+uint8_t lcd_display_global_memory[LCD_FRAME_BUFFER_SIZE * LCD_NB_FRAME_BUFFERS];
 
-/*External SDRAM memory is used to store the LCD buffer*/
+#if LCD_CAMERA_LAYER_MODE
+/* Camera layer frame buffers (RGB565, at most the LCD size), flipped together
+ * with the drawing layer ones */
+#define LCD_CAMERA_BBP 2
+#define LCD_CAMERA_BUFFER_SIZE (LCD_RES_WIDTH * LCD_RES_HEIGHT * LCD_CAMERA_BBP)
+
+#if defined(__ICCARM__)
+#pragma location = "Lcd_Display"
+#elif defined(__CC_ARM)
+__attribute__((section(".Lcd_Display"), zero_init))
+#elif defined(__GNUC__)
+__attribute__((section(".Lcd_Display")))
+#else
+#error Unknown compiler
+#endif
+uint8_t lcd_camera_layer_memory[LCD_CAMERA_BUFFER_SIZE * LCD_NB_FRAME_BUFFERS];
+
+/* Camera image size, scale on the layer, whether the write buffer got a new
+ * image and which buffers miss the last one */
+static uint16_t lcd_camera_width = 0;
+static uint16_t lcd_camera_height = 0;
+static uint8_t lcd_camera_scale = 1;
+static uint8_t lcd_camera_written = 0;
+static uint8_t lcd_camera_stale[LCD_NB_FRAME_BUFFERS];
+/* L8 CLUT of the camera image conversions */
+ALIGN_32BYTES(static uint32_t lcd_camera_clut[256]);
+#endif
+
+/*External SDRAM memory is used to store the LCD buffers*/
 uint8_t *lcd_frame_read_buff = lcd_display_global_memory;
 uint8_t *lcd_frame_write_buff =
     lcd_display_global_memory + LCD_FRAME_BUFFER_SIZE;
 
+/* Page flip state: buffer scanned out by the LTDC, buffer waiting for the
+ * next vertical blanking and buffer being rendered (LCD_NO_BUFFER if none) */
+#define LCD_NO_BUFFER 0xFFU
+static volatile uint8_t lcd_front = 0;
+static volatile uint8_t lcd_pending = LCD_NO_BUFFER;
+static volatile uint8_t lcd_back = 1;
+static volatile DMA2D_Fence_t lcd_pending_fence = 0;
+/* Buffer of the last refreshed frame, the reference for the other buffers */
+static uint8_t lcd_last = 0;
+
+/* Damaged areas: of the frame being rendered, and per buffer the areas changed
+ * by the frames refreshed since it was last rendered (to be copied from the last
+ * refreshed buffer before rendering in it again) */
+typedef struct
+{
+  uint16_t x0;
+  uint16_t y0;
+  uint16_t x1; /* Exclusive */
+  uint16_t y1; /* Exclusive */
+} LCD_Rect_t;
+
+typedef struct
+{
+  LCD_Rect_t rect[LCD_DAMAGE_MAX_RECTS];
+  uint32_t count;
+} LCD_Damage_t;
+
+static LCD_Damage_t lcd_damage;
+static LCD_Damage_t lcd_stale[LCD_NB_FRAME_BUFFERS];
+/* Areas the frame being rendered overwrites entirely (not merged, a union may
+ * cover areas left as they are), see LCD_WillOverwriteRect() */
+static LCD_Damage_t lcd_overwrite;
+
+/* DMA2D job queue: register images of the queued jobs, fences being job
+ * numbers (jobs submitted - completed are in the ring, the oldest running) */
+typedef struct
+{
+  uint32_t cr;
+  uint32_t fgpfccr;
+  uint32_t fgcolr;
+  uint32_t fgmar;
+  uint32_t fgor;
+  uint32_t fgcmar;
+  uint32_t bgpfccr;
+  uint32_t bgmar;
+  uint32_t bgor;
+  uint32_t opfccr;
+  uint32_t ocolr;
+  uint32_t omar;
+  uint32_t oor;
+  uint32_t nlr;
+} DMA2D_Regs_t;
+
+static DMA2D_Regs_t dma2d_ring[DMA2D_QUEUE_LENGTH];
+static volatile uint32_t dma2d_submitted = 0;
+static volatile uint32_t dma2d_completed = 0;
+/* Whether a queue job is running (jobs wait while a DMA2D resize runs) */
+static volatile uint8_t dma2d_running = 0;
+static volatile uint32_t dma2d_errors = 0;
+/* Time spent running queue jobs (cycles), and start of the current busy period */
+static volatile uint64_t dma2d_busy_cycles = 0;
+static volatile uint32_t dma2d_busy_start = 0;
+/* Last values programmed by the queue, invalid once another DMA2D user ran */
+static DMA2D_Regs_t dma2d_shadow;
+static volatile uint8_t dma2d_shadow_valid = 0;
+/* Whether the running job waits for its CLUT to be loaded, and size field of
+ * the loaded CLUT (its address being the shadow FGCMAR) */
+static volatile uint8_t dma2d_clut_loading = 0;
+static uint32_t dma2d_clut_size = 0;
+
+/* Preloaded L8 palettes, see DMA2D_GetPalette() */
+ALIGN_32BYTES(static uint32_t dma2d_palettes[IMG_PALETTE_FALSE_COLOR + 1][256]);
+
+#define DMA2D_QUEUE_IT (DMA2D_CR_TCIE | DMA2D_CR_TEIE | DMA2D_CR_CEIE | DMA2D_CR_CTCIE | DMA2D_CR_CAEIE)
+
 /* Private function prototypes -----------------------------------------------*/
 static uint32_t GetBytesPerPixel(uint32_t dma2d_color);
+static void LCD_WaitWriteBuffer(void);
+static void LCD_DamageAdd(LCD_Damage_t *damage, LCD_Rect_t rect);
+static void LCD_DamageSubtract(LCD_Damage_t *damage, const LCD_Rect_t *cut);
+static int LCD_ClipRect(LCD_Rect_t *rect, uint16_t x, uint16_t y, uint16_t xsize, uint16_t ysize);
+static void LCD_CacheRect(uint8_t *pBuffer, const LCD_Rect_t *rect, int invalidate);
+static void DMA2D_QueueProgram(const DMA2D_Regs_t *regs);
+static uint32_t DMA2D_OutputColor(uint32_t color, uint32_t output_color_format);
 
+/**
+ * @brief Returns the LCD write buffer, waiting for one to be released by the
+ * display in double buffering mode. To be called before drawing a new frame,
+ * BSP_LCD drawing functions then also target this buffer.
+ *
+ * @return LCD write buffer
+ */
 uint8_t *get_lcd_frame_write_buff(void)
 {
+  LCD_WaitWriteBuffer();
   return lcd_frame_write_buff;
 }
 
@@ -62,18 +180,50 @@ void LCD_Init(void)
 
   MICROTRACE_BEGIN("Display", "LCD_INIT");
   BSP_LCD_Init();
-  BSP_LCD_LayerDefaultInit(0, (uint32_t)lcd_frame_read_buff);
+#if LCD_CAMERA_LAYER_MODE
+  /* Hidden until LCD_CameraLayerInit() */
+  BSP_LCD_LayerDefaultInit(LCD_CAMERA_LAYER, (uint32_t)lcd_camera_layer_memory);
+  BSP_LCD_SetLayerVisible(LCD_CAMERA_LAYER, DISABLE);
+#endif
+  BSP_LCD_LayerDefaultInit(LCD_UI_LAYER, (uint32_t)lcd_frame_read_buff);
+  BSP_LCD_SelectLayer(LCD_UI_LAYER);
 
   BSP_LCD_SetBackColor(LCD_COLOR_BLACK);
   BSP_LCD_SetTextColor(LCD_COLOR_WHITE);
   BSP_LCD_SetFont(&Font24);
 
-  LCD_SetFBStartAdress(0, (uint32_t)lcd_frame_write_buff);
+  for (uint32_t i = 0; i <= IMG_PALETTE_FALSE_COLOR; i++)
+  {
+    ImgPaletteInit((imgpalette_t)i, dma2d_palettes[i]);
+  }
+  SCB_CleanDCache_by_Addr((uint32_t *)dma2d_palettes, sizeof(dma2d_palettes));
+
+  /* Start from empty frames, whichever buffer is displayed */
+  for (uint32_t i = 0; i < LCD_NB_FRAME_BUFFERS; i++)
+  {
+    LCD_SetFBStartAdress(LCD_UI_LAYER, (uint32_t)&lcd_display_global_memory[i * LCD_FRAME_BUFFER_SIZE]);
+    BSP_LCD_Clear(LCD_UI_BACKGROUND);
+  }
+
+  LCD_SetFBStartAdress(LCD_UI_LAYER, (uint32_t)lcd_frame_write_buff);
+
+  /* Line interrupt at the first line of the vertical blanking, for page flips
+   * and vertical blanking timestamps */
+  LTDC->LIPCR = hltdc_discovery.Init.AccumulatedActiveH + 1;
+  __HAL_LTDC_ENABLE_IT(&hltdc_discovery, LTDC_IT_LI);
+
+  /* All buffers are identical */
+  lcd_damage.count = 0;
+  lcd_overwrite.count = 0;
+  for (uint32_t i = 0; i < LCD_NB_FRAME_BUFFERS; i++)
+  {
+    lcd_stale[i].count = 0;
+  }
   MICROTRACE_END("Display", "LCD_INIT");
 }
 
 uint32_t* GetWriteBuffer(void){
-	return lcd_frame_read_buff;
+	return (uint32_t *)lcd_frame_read_buff;
 }
 
 /**
@@ -89,18 +239,530 @@ uint32_t* GetWriteBuffer(void){
 //}
 
 /**
- * @brief Refreshes LCD screen by performing a DMA transfer from lcd write buffer to lcd read buffer
+ * @brief Tells whether a write buffer is available at once, i.e. whether
+ * get_lcd_frame_write_buff() and the drawing functions would not wait for a
+ * pending page flip
+ *
+ * @return 1 if a write buffer is available, else 0
+ */
+int LCD_WriteBufferReady(void)
+{
+  if (lcd_back != LCD_NO_BUFFER)
+  {
+    return 1;
+  }
+  for (uint8_t i = 0; i < LCD_NB_FRAME_BUFFERS; i++)
+  {
+    /* Pending before front, as in LCD_WaitWriteBuffer() */
+    const uint8_t pending = lcd_pending;
+    const uint8_t front = lcd_front;
+    if ((i != front) && (i != pending))
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Refreshes LCD screen by queuing the write buffer for display: the LTDC
+ * layer is switched to it on the next vertical blanking (LTDC line interrupt).
+ * Never waits, the next write buffer being picked by get_lcd_frame_write_buff().
+ * The flip is postponed until the DMA2D jobs queued so far are complete.
+ * With triple buffering, a buffer still waiting for display is replaced (and
+ * freed) by the new one.
+ * Only the areas reported by LCD_AddDirtyRect() are cleaned from the D-Cache,
+ * and become stale in the other buffers.
  *
  */
 void LCD_Refresh(void)
 {
-  /*Coherency purpose: clean the lcd_frame_write_buff area in L1 D-Cache before DMA2D reading*/
-  SCB_CleanDCache_by_Addr((void *)lcd_frame_write_buff, LCD_FRAME_BUFFER_SIZE);
+  uint8_t released;
+  uint32_t primask;
+
+  LCD_WaitWriteBuffer();
+
+  /*Coherency purpose: clean the damaged lcd_frame_write_buff areas in L1 D-Cache before LTDC reading*/
+  for (uint32_t i = 0; i < lcd_damage.count; i++)
+  {
+    LCD_CacheRect(lcd_frame_write_buff, &lcd_damage.rect[i], 0);
+    for (uint32_t b = 0; b < LCD_NB_FRAME_BUFFERS; b++)
+    {
+      if (b != lcd_back)
+      {
+        LCD_DamageAdd(&lcd_stale[b], lcd_damage.rect[i]);
+      }
+    }
+  }
+  lcd_damage.count = 0;
+  lcd_overwrite.count = 0;
+
+#if LCD_CAMERA_LAYER_MODE
+  if (lcd_camera_written)
+  {
+    for (uint32_t b = 0; b < LCD_NB_FRAME_BUFFERS; b++)
+    {
+      lcd_camera_stale[b] = (b != lcd_back);
+    }
+    lcd_camera_written = 0;
+  }
+  else if (lcd_camera_stale[lcd_back])
+  {
+    /* No new camera image for this frame: show the last one again */
+    const uint16_t xsize = lcd_camera_width * lcd_camera_scale;
+    const uint16_t ysize = lcd_camera_height * lcd_camera_scale;
+
+    DMA2D_QueueCopy((uint32_t *)&lcd_camera_layer_memory[lcd_last * LCD_CAMERA_BUFFER_SIZE],
+                    (uint32_t *)&lcd_camera_layer_memory[lcd_back * LCD_CAMERA_BUFFER_SIZE], 0, 0, xsize,
+                    ysize, xsize, DMA2D_INPUT_RGB565, DMA2D_OUTPUT_RGB565, 0, 0, NULL);
+    lcd_camera_stale[lcd_back] = 0;
+  }
+#endif
+  lcd_last = lcd_back;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  released = lcd_pending;
+  lcd_pending = lcd_back;
+  lcd_pending_fence = DMA2D_QueueLastFence();
+  lcd_back = LCD_NO_BUFFER;
+  __set_PRIMASK(primask);
+
+  /* Triple buffering: the frame not displayed in time is recycled at once */
+  if (released != LCD_NO_BUFFER)
+  {
+    lcd_back = released;
+  }
+}
+
+/**
+ * @brief Reports an area of the write buffer modified since the last refresh.
+ * BSP_LCD drawing functions and LCD_DMA2D2LCDWriteBuffer() report their areas,
+ * other writes to the buffer returned by get_lcd_frame_write_buff() must be
+ * reported by the application.
+ *
+ * @param x x position in pixels
+ * @param y y position in pixels
+ * @param xsize width in pixels
+ * @param ysize height in pixels
+ */
+void LCD_AddDirtyRect(uint16_t x, uint16_t y, uint16_t xsize, uint16_t ysize)
+{
+  LCD_Rect_t rect;
+
+  if (LCD_ClipRect(&rect, x, y, xsize, ysize))
+  {
+    LCD_DamageAdd(&lcd_damage, rect);
+  }
+}
+
+/**
+ * @brief Announces an area that the next frame overwrites entirely (every pixel,
+ * opaque), before get_lcd_frame_write_buff(): the copy of its stale content from
+ * the last refreshed buffer is skipped. The area must still be reported by
+ * LCD_AddDirtyRect() once written. Valid until the next LCD_Refresh().
+ *
+ * @param x x position in pixels
+ * @param y y position in pixels
+ * @param xsize width in pixels
+ * @param ysize height in pixels
+ */
+void LCD_WillOverwriteRect(uint16_t x, uint16_t y, uint16_t xsize, uint16_t ysize)
+{
+  LCD_Rect_t rect;
+
+  /* Beyond the list capacity, the area is just copied */
+  if ((lcd_overwrite.count < LCD_DAMAGE_MAX_RECTS) && LCD_ClipRect(&rect, x, y, xsize, ysize))
+  {
+    lcd_overwrite.rect[lcd_overwrite.count++] = rect;
+  }
+}
+
+/**
+ * @brief Converts an area to a rectangle clipped to the screen
+ *
+ * @param rect rectangle to fill in
+ * @param x x position in pixels
+ * @param y y position in pixels
+ * @param xsize width in pixels
+ * @param ysize height in pixels
+ * @return 1 if the rectangle is not empty, else 0
+ */
+static int LCD_ClipRect(LCD_Rect_t *rect, uint16_t x, uint16_t y, uint16_t xsize, uint16_t ysize)
+{
+  if ((x >= LCD_RES_WIDTH) || (y >= LCD_RES_HEIGHT) || (xsize == 0) || (ysize == 0))
+  {
+    return 0;
+  }
+  rect->x0 = x;
+  rect->y0 = y;
+  rect->x1 = ((uint32_t)x + xsize > LCD_RES_WIDTH) ? LCD_RES_WIDTH : x + xsize;
+  rect->y1 = ((uint32_t)y + ysize > LCD_RES_HEIGHT) ? LCD_RES_HEIGHT : y + ysize;
+  return 1;
+}
+
+/**
+ * @brief BSP_LCD drawing functions damage report
+ *
+ */
+void BSP_LCD_DamageCallback(uint32_t LayerIndex, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  if (LayerIndex == LCD_UI_LAYER)
+  {
+    LCD_AddDirtyRect(Xpos, Ypos, Width, Height);
+  }
+}
+
+/**
+ * @brief Adds a rectangle to a damage list: overlapping or touching rectangles
+ * are merged, and once the list is full the rectangle is merged with the one
+ * growing the least
+ *
+ * @param damage damage list
+ * @param rect rectangle, clipped to the screen
+ */
+static void LCD_DamageAdd(LCD_Damage_t *damage, LCD_Rect_t rect)
+{
+  uint32_t i = 0;
+
+  while (i < damage->count)
+  {
+    const LCD_Rect_t *r = &damage->rect[i];
+
+    if ((rect.x0 <= r->x1) && (r->x0 <= rect.x1) && (rect.y0 <= r->y1) && (r->y0 <= rect.y1))
+    {
+      /* Absorb it and look again, the union may touch other rectangles */
+      rect.x0 = (r->x0 < rect.x0) ? r->x0 : rect.x0;
+      rect.y0 = (r->y0 < rect.y0) ? r->y0 : rect.y0;
+      rect.x1 = (r->x1 > rect.x1) ? r->x1 : rect.x1;
+      rect.y1 = (r->y1 > rect.y1) ? r->y1 : rect.y1;
+      damage->rect[i] = damage->rect[--damage->count];
+      i = 0;
+    }
+    else
+    {
+      i++;
+    }
+  }
+
+  if (damage->count < LCD_DAMAGE_MAX_RECTS)
+  {
+    damage->rect[damage->count++] = rect;
+  }
+  else
+  {
+    uint32_t best = 0;
+    uint32_t best_growth = UINT32_MAX;
+
+    for (i = 0; i < damage->count; i++)
+    {
+      const LCD_Rect_t *r = &damage->rect[i];
+      const uint32_t w = ((r->x1 > rect.x1) ? r->x1 : rect.x1) - ((r->x0 < rect.x0) ? r->x0 : rect.x0);
+      const uint32_t h = ((r->y1 > rect.y1) ? r->y1 : rect.y1) - ((r->y0 < rect.y0) ? r->y0 : rect.y0);
+      const uint32_t growth = w * h - (uint32_t)(r->x1 - r->x0) * (r->y1 - r->y0);
+
+      if (growth < best_growth)
+      {
+        best = i;
+        best_growth = growth;
+      }
+    }
+    rect.x0 = (damage->rect[best].x0 < rect.x0) ? damage->rect[best].x0 : rect.x0;
+    rect.y0 = (damage->rect[best].y0 < rect.y0) ? damage->rect[best].y0 : rect.y0;
+    rect.x1 = (damage->rect[best].x1 > rect.x1) ? damage->rect[best].x1 : rect.x1;
+    rect.y1 = (damage->rect[best].y1 > rect.y1) ? damage->rect[best].y1 : rect.y1;
+    damage->rect[best] = damage->rect[--damage->count];
+    LCD_DamageAdd(damage, rect);
+  }
+}
+
+/**
+ * @brief Removes an area from a damage list: each rectangle it overlaps is split
+ * into the (up to 4) bands around it. The bands are not merged back, and a
+ * rectangle stays whole when the list has no room for them.
+ *
+ * @param damage damage list
+ * @param cut area to remove
+ */
+static void LCD_DamageSubtract(LCD_Damage_t *damage, const LCD_Rect_t *cut)
+{
+  uint32_t i = 0;
+
+  while (i < damage->count)
+  {
+    const LCD_Rect_t r = damage->rect[i];
+    LCD_Rect_t bands[4];
+    uint32_t count = 0;
+
+    if ((cut->x0 >= r.x1) || (r.x0 >= cut->x1) || (cut->y0 >= r.y1) || (r.y0 >= cut->y1))
+    {
+      i++;
+      continue;
+    }
+
+    /* Full width above and below, then left and right of the cut */
+    const uint16_t y0 = (cut->y0 > r.y0) ? cut->y0 : r.y0;
+    const uint16_t y1 = (cut->y1 < r.y1) ? cut->y1 : r.y1;
+    if (r.y0 < y0)
+    {
+      bands[count++] = (LCD_Rect_t){r.x0, r.y0, r.x1, y0};
+    }
+    if (y1 < r.y1)
+    {
+      bands[count++] = (LCD_Rect_t){r.x0, y1, r.x1, r.y1};
+    }
+    if (r.x0 < cut->x0)
+    {
+      bands[count++] = (LCD_Rect_t){r.x0, y0, cut->x0, y1};
+    }
+    if (cut->x1 < r.x1)
+    {
+      bands[count++] = (LCD_Rect_t){cut->x1, y0, r.x1, y1};
+    }
+
+    if (damage->count - 1 + count > LCD_DAMAGE_MAX_RECTS)
+    {
+      i++;
+      continue;
+    }
+    /* The bands go to the end of the list, past the cut */
+    damage->rect[i] = damage->rect[--damage->count];
+    for (uint32_t b = 0; b < count; b++)
+    {
+      damage->rect[damage->count++] = bands[b];
+    }
+  }
+}
+
+/**
+ * @brief Cleans (or cleans and invalidates) a rectangle of a frame buffer in
+ * L1 D-Cache, line by line unless it spans whole lines
+ *
+ * @param pBuffer frame buffer
+ * @param rect rectangle
+ * @param invalidate 0 to clean, 1 to clean and invalidate
+ */
+static void LCD_CacheRect(uint8_t *pBuffer, const LCD_Rect_t *rect, int invalidate)
+{
+  const uint32_t line_size = LCD_RES_WIDTH * LCD_BBP;
+  const uint32_t width = (rect->x1 - rect->x0) * LCD_BBP;
+  const uint32_t nb_lines = (rect->x0 == 0 && rect->x1 == LCD_RES_WIDTH) ? 1 : (rect->y1 - rect->y0);
+  const uint32_t size = (nb_lines == 1) ? (rect->y1 - rect->y0) * line_size : width;
+  uint32_t start = (uint32_t)pBuffer + rect->y0 * line_size + rect->x0 * LCD_BBP;
+
+  for (uint32_t i = 0; i < nb_lines; i++, start += line_size)
+  {
+    /* Cache maintenance by address requires 32-byte aligned areas */
+    const uint32_t aligned = start & ~31U;
+    const int32_t aligned_size = (int32_t)(start + size - aligned);
+
+    if (invalidate)
+    {
+      SCB_CleanInvalidateDCache_by_Addr((uint32_t *)aligned, aligned_size);
+    }
+    else
+    {
+      SCB_CleanDCache_by_Addr((uint32_t *)aligned, aligned_size);
+    }
+  }
+}
+
+/**
+ * @brief Waits for a buffer which is neither displayed nor waiting for display,
+ * and makes it the write buffer (also for BSP_LCD drawing functions). Areas
+ * changed by the frames it missed are then copied by DMA2D from the last
+ * refreshed buffer, so that it holds the last frame, except those the frame
+ * overwrites (LCD_WillOverwriteRect()).
+ *
+ */
+static void LCD_WaitWriteBuffer(void)
+{
+  if (lcd_back == LCD_NO_BUFFER)
+  {
+    uint8_t i = 0;
+
+    /* Only waits in double buffering mode, until the pending flip is done */
+    for (;;)
+    {
+      /* Pending before front: a flip in between moves pending to front */
+      const uint8_t pending = lcd_pending;
+      const uint8_t front = lcd_front;
+      if ((i != front) && (i != pending))
+      {
+        break;
+      }
+      i = (i + 1) % LCD_NB_FRAME_BUFFERS;
+    }
+    lcd_back = i;
+  }
+
+  lcd_frame_write_buff = &lcd_display_global_memory[lcd_back * LCD_FRAME_BUFFER_SIZE];
+  LCD_SetFBStartAdress(LCD_UI_LAYER, (uint32_t)lcd_frame_write_buff);
+
+  for (uint32_t o = 0; (o < lcd_overwrite.count) && (lcd_stale[lcd_back].count != 0); o++)
+  {
+    LCD_DamageSubtract(&lcd_stale[lcd_back], &lcd_overwrite.rect[o]);
+  }
+
+  if (lcd_stale[lcd_back].count != 0)
+  {
+    LCD_Damage_t *stale = &lcd_stale[lcd_back];
+    uint8_t *pLast = &lcd_display_global_memory[lcd_last * LCD_FRAME_BUFFER_SIZE];
+    DMA2D_Job_t job = {0};
+
+    job.Mode = DMA2D_M2M;
+    job.FgColorMode = DMA2D_INPUT_ARGB8888;
+    job.OutColorMode = DMA2D_OUTPUT_ARGB8888;
+    for (uint32_t r = 0; r < stale->count; r++)
+    {
+      const LCD_Rect_t *rect = &stale->rect[r];
+      const uint32_t offset = (rect->y0 * LCD_RES_WIDTH + rect->x0) * LCD_BBP;
+
+      /* No stale cache line may overwrite the copy afterwards */
+      LCD_CacheRect(lcd_frame_write_buff, rect, 1);
+
+      job.FgAddress = (uint32_t)pLast + offset;
+      job.FgOffset = LCD_RES_WIDTH - (rect->x1 - rect->x0);
+      job.OutAddress = (uint32_t)lcd_frame_write_buff + offset;
+      job.OutOffset = job.FgOffset;
+      job.Width = rect->x1 - rect->x0;
+      job.Height = rect->y1 - rect->y0;
+      DMA2D_QueueSubmit(&job);
+    }
+    stale->count = 0;
+
+    /* The CPU may draw over the copied areas */
+    DMA2D_FenceWait(DMA2D_QueueLastFence());
+  }
+}
+
+/**
+ * @brief LTDC line event callback, at each vertical blanking: performs the
+ * pending page flip, unless still being rendered by the DMA2D (then tried again
+ * next frame). The layer address register is written directly, the HAL layer
+ * configuration holding the write buffer address for BSP_LCD drawing.
+ *
+ * @param hltdc LTDC handle
+ */
+void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+  SCHED_VblankEvent();
+  __HAL_LTDC_ENABLE_IT(hltdc, LTDC_IT_LI);
+
+  if ((lcd_pending != LCD_NO_BUFFER) && DMA2D_FenceDone(lcd_pending_fence))
+  {
+    lcd_frame_read_buff = &lcd_display_global_memory[lcd_pending * LCD_FRAME_BUFFER_SIZE];
+    LTDC_LAYER(hltdc, LCD_UI_LAYER)->CFBAR = (uint32_t)lcd_frame_read_buff;
+#if LCD_CAMERA_LAYER_MODE
+    /* The camera layer configuration holds its displayed buffer */
+    hltdc->LayerCfg[LCD_CAMERA_LAYER].FBStartAdress =
+        (uint32_t)&lcd_camera_layer_memory[lcd_pending * LCD_CAMERA_BUFFER_SIZE];
+    LTDC_LAYER(hltdc, LCD_CAMERA_LAYER)->CFBAR = hltdc->LayerCfg[LCD_CAMERA_LAYER].FBStartAdress;
+#endif
+    hltdc->Instance->SRCR = LTDC_SRCR_IMR;
+    lcd_front = lcd_pending;
+    lcd_pending = LCD_NO_BUFFER;
+  }
+}
+
+#if LCD_CAMERA_LAYER_MODE
+/**
+ * @brief Sets up the camera layer: window position and size, grey palette of the
+ * camera conversions, and black initial content. The image is 2x scaled if it
+ * fits in the screen. The palette entries hold the output pixels: two identical
+ * RGB565 pixels when scaling (an L8 to ARGB8888 conversion then writes each
+ * pixel twice), else grey ARGB8888 colors (L8 to RGB565 conversion).
+ *
+ * @param x x position on LCD in pixels
+ * @param y y position on LCD in pixels
+ * @param width width of the camera image in pixels
+ * @param height height of the camera image in pixels
+ */
+void LCD_CameraLayerInit(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+  uint32_t primask;
+
+  lcd_camera_scale = ((x + 2 * width <= LCD_RES_WIDTH) && (y + 2 * height <= LCD_RES_HEIGHT)) ? 2 : 1;
+  lcd_camera_width = width;
+  lcd_camera_height = height;
+
+  /* The palette is not read by queued jobs once the queue is idle, and is
+   * loaded again by the next job using it */
+  BSP_LCD_DMA2D_WaitIdle();
+  for (uint32_t g = 0; g < 256; g++)
+  {
+    const uint32_t rgb565 = ((g >> 3) << 11) | ((g >> 2) << 5) | (g >> 3);
+
+    lcd_camera_clut[g] = (lcd_camera_scale == 2) ? ((rgb565 << 16) | rgb565) : (0xFF000000 | (g * 0x010101));
+  }
+  SCB_CleanDCache_by_Addr(lcd_camera_clut, sizeof(lcd_camera_clut));
 
-  DMA2D_MEMCOPY((uint32_t *)(lcd_frame_write_buff), (uint32_t *)(lcd_frame_read_buff), 0, 0, LCD_RES_WIDTH,
-                LCD_RES_HEIGHT, LCD_RES_WIDTH, DMA2D_INPUT_ARGB8888, DMA2D_OUTPUT_ARGB8888, 0, 0);
+  for (uint32_t i = 0; i < LCD_NB_FRAME_BUFFERS; i++)
+  {
+    DMA2D_QueueFill((uint32_t *)&lcd_camera_layer_memory[i * LCD_CAMERA_BUFFER_SIZE], 0, 0,
+                    width * lcd_camera_scale, height * lcd_camera_scale, width * lcd_camera_scale,
+                    DMA2D_OUTPUT_RGB565, LCD_COLOR_BLACK);
+    lcd_camera_stale[i] = 0;
+  }
+  DMA2D_FenceWait(DMA2D_QueueLastFence());
+
+  /* The HAL reprograms the layer address from its configuration, keep it in
+   * line with the page flip */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  LCD_SetFBStartAdress(LCD_CAMERA_LAYER, (uint32_t)&lcd_camera_layer_memory[lcd_front * LCD_CAMERA_BUFFER_SIZE]);
+  HAL_LTDC_SetPixelFormat(&hltdc_discovery, LTDC_PIXEL_FORMAT_RGB565, LCD_CAMERA_LAYER);
+  BSP_LCD_SetLayerWindow(LCD_CAMERA_LAYER, x, y, width * lcd_camera_scale, height * lcd_camera_scale);
+  BSP_LCD_SetLayerVisible(LCD_CAMERA_LAYER, ENABLE);
+  __set_PRIMASK(primask);
 }
 
+/**
+ * @brief Queues the conversion of a grayscale camera image to the camera layer
+ * write buffer, displayed on the next LCD_Refresh(). The image is cleaned from
+ * the D-Cache, and must stay untouched until the returned fence is done.
+ *
+ * @param pGray GRAY8 image of the size given to LCD_CameraLayerInit()
+ * @return fence of the conversion
+ */
+DMA2D_Fence_t LCD_CameraLayerWriteGray(const uint8_t *pGray)
+{
+  DMA2D_Job_t job = {0};
+  uint8_t *pDst;
+  const uint32_t aligned = (uint32_t)pGray & ~31U;
+
+  LCD_WaitWriteBuffer();
+  pDst = &lcd_camera_layer_memory[lcd_back * LCD_CAMERA_BUFFER_SIZE];
+
+  SCB_CleanDCache_by_Addr((uint32_t *)aligned,
+                          (int32_t)((uint32_t)pGray + lcd_camera_width * lcd_camera_height - aligned));
+
+  job.Mode = DMA2D_M2M_PFC;
+  job.FgAddress = (uint32_t)pGray;
+  job.FgColorMode = DMA2D_INPUT_L8;
+  job.FgAlphaMode = DMA2D_NO_MODIF_ALPHA;
+  job.FgClut = lcd_camera_clut;
+  job.Width = lcd_camera_width;
+  job.Height = lcd_camera_height;
+  job.OutAddress = (uint32_t)pDst;
+  lcd_camera_written = 1;
+
+  if (lcd_camera_scale == 1)
+  {
+    job.OutColorMode = DMA2D_OUTPUT_RGB565;
+    return DMA2D_QueueSubmit(&job);
+  }
+
+  /* Each ARGB8888 output pixel is a pair of RGB565 pixels: even lines, then
+   * odd lines */
+  job.OutColorMode = DMA2D_OUTPUT_ARGB8888;
+  job.OutOffset = lcd_camera_width;
+  DMA2D_QueueSubmit(&job);
+  job.OutAddress += 2 * lcd_camera_width * LCD_CAMERA_BBP;
+  return DMA2D_QueueSubmit(&job);
+}
+#endif
+
 /**
  * @brief Performs a DMA transfer from buffer to LCD write buffer with optional pixel format conversion and red/blue
  * channel swap
@@ -110,14 +772,70 @@ void LCD_Refresh(void)
  * @param y y position on LCD in pixels
  * @param xsize width of the image to write in pixels
  * @param ysize height of the image to write in pixels
- * @param input_color_format input color format (e.g DMA2D_INPUT_RGB888)
+ * @param input_color_format input color format (e.g DMA2D_INPUT_RGB888, DMA2D_INPUT_L8)
  * @param red_blue_swap boolean flag for red-blue channel swap, 0 is no swap, 1 is swap
+ * @param pClut CLUT of indexed input formats (e.g. DMA2D_GetPalette()), else NULL
  */
 void LCD_DMA2D2LCDWriteBuffer(uint32_t *pSrc, uint16_t x, uint16_t y, uint16_t xsize, uint16_t ysize,
-                              uint32_t input_color_format, int red_blue_swap)
+                              uint32_t input_color_format, int red_blue_swap, const uint32_t *pClut)
 {
+  LCD_WaitWriteBuffer();
   DMA2D_MEMCOPY((uint32_t *)pSrc, (uint32_t *)lcd_frame_write_buff, x, y, xsize, ysize, LCD_RES_WIDTH,
-                input_color_format, DMA2D_OUTPUT_ARGB8888, 1, red_blue_swap);
+                input_color_format, DMA2D_OUTPUT_ARGB8888, 1, red_blue_swap, pClut);
+  LCD_AddDirtyRect(x, y, xsize, ysize);
+}
+
+/**
+ * @brief Blits an image to the LCD write buffer with pixel format conversion,
+ * GRAY8 images going through an L8 palette. The image is cleaned from the
+ * D-Cache, views on larger buffers are supported.
+ *
+ * @param img GRAY8, RGB565 or RGB888 image
+ * @param x x position on LCD in pixels
+ * @param y y position on LCD in pixels
+ * @param palette palette of GRAY8 images
+ */
+void LCD_DMA2D2LCDWriteImage(Image_t *img, uint16_t x, uint16_t y, imgpalette_t palette)
+{
+  DMA2D_Job_t job = {0};
+  const uint32_t bpp = IMG_BYTES_PER_PX(img->format);
+  const uint32_t stride = IMG_STRIDE(img);
+  const uint32_t aligned = (uint32_t)img->pData & ~31U;
+  const uint32_t end = (uint32_t)img->pData + (img->height - 1) * stride + img->width * bpp;
+
+  switch (img->format)
+  {
+    case PXFMT_GRAY8:
+      job.FgColorMode = DMA2D_INPUT_L8;
+      job.FgClut = DMA2D_GetPalette(palette);
+      break;
+    case PXFMT_RGB565:
+      job.FgColorMode = DMA2D_INPUT_RGB565;
+      break;
+    case PXFMT_RGB888:
+      /* Red first in memory, as written by ImgToRGB888() */
+      job.FgColorMode = DMA2D_INPUT_RGB888;
+      job.FgRedBlueSwap = DMA2D_RB_SWAP;
+      break;
+    default:
+      return;
+  }
+
+  SCB_CleanDCache_by_Addr((uint32_t *)aligned, (int32_t)(end - aligned));
+  LCD_WaitWriteBuffer();
+
+  job.Mode = DMA2D_M2M_PFC;
+  job.FgAddress = (uint32_t)img->pData;
+  job.FgOffset = stride / bpp - img->width;
+  job.FgAlphaMode = DMA2D_REPLACE_ALPHA;
+  job.FgAlpha = 0xFF;
+  job.OutAddress = (uint32_t)lcd_frame_write_buff + (y * LCD_RES_WIDTH + x) * 4;
+  job.OutOffset = LCD_RES_WIDTH - img->width;
+  job.OutColorMode = DMA2D_OUTPUT_ARGB8888;
+  job.Width = img->width;
+  job.Height = img->height;
+  DMA2D_FenceWait(DMA2D_QueueSubmit(&job));
+  LCD_AddDirtyRect(x, y, img->width, img->height);
 }
 
 /**
@@ -134,50 +852,467 @@ void LCD_DMA2D2LCDWriteBuffer(uint32_t *pSrc, uint16_t x, uint16_t y, uint16_t x
  * @param output_color_format output color format (e.g DMA2D_OUTPUT_ARGB888)
  * @param pfc boolean flag for pixel format conversion (set to 1 if input and output format are different, else 0)
  * @param red_blue_swap boolean flag for red-blue channel swap, 0 if no swap, else 1
+ * @param pClut CLUT of indexed input formats (DMA2D_INPUT_L8, DMA2D_INPUT_L4, ...), else NULL. Loaded before the
+ * transfer, unless the previous DMA2D job used the same one.
  */
 void DMA2D_MEMCOPY(uint32_t *pSrc, uint32_t *pDst, uint16_t x, uint16_t y, uint16_t xsize, uint16_t ysize,
                    uint32_t rowStride, uint32_t input_color_format, uint32_t output_color_format, int pfc,
-                   int red_blue_swap)
+                   int red_blue_swap, const uint32_t *pClut)
 {
-  static DMA2D_HandleTypeDef DMA2D_Handle;
+  DMA2D_FenceWait(DMA2D_QueueCopy(pSrc, pDst, x, y, xsize, ysize, rowStride, input_color_format,
+                                  output_color_format, pfc, red_blue_swap, pClut));
+}
 
-  uint32_t bytepp = GetBytesPerPixel(output_color_format);
+/**
+ * @brief Returns a preloaded 256-entry ARGB8888 palette for L8 inputs, in memory
+ * read by the DMA2D (built by LCD_Init())
+ *
+ * @param palette IMG_PALETTE_GRAY (identity) or IMG_PALETTE_FALSE_COLOR
+ * @return palette, to be given as CLUT to the DMA2D copies
+ */
+const uint32_t *DMA2D_GetPalette(imgpalette_t palette)
+{
+  return dma2d_palettes[(palette == IMG_PALETTE_FALSE_COLOR) ? IMG_PALETTE_FALSE_COLOR : IMG_PALETTE_GRAY];
+}
 
-  uint32_t destination = (uint32_t)pDst + (y * rowStride + x) * bytepp;
-  uint32_t source = (uint32_t)pSrc;
+/**
+ * @brief Queues a DMA2D job, started at once if the DMA2D is idle, else from the
+ * transfer complete interrupt of the previous job. Waits only if the queue is full.
+ * Source areas written by the CPU must be cleaned from the D-Cache beforehand.
+ * A job CLUT is loaded only if the previous job used another one: a CLUT changed
+ * in place must be written once the queue is idle (BSP_LCD_DMA2D_WaitIdle()).
+ *
+ * @param job job description
+ * @return fence of the job
+ */
+DMA2D_Fence_t DMA2D_QueueSubmit(const DMA2D_Job_t *job)
+{
+  DMA2D_Regs_t regs;
+  DMA2D_Fence_t fence;
+  uint32_t primask;
+  uint32_t fg_alpha;
+  uint32_t clut_size = 0;
 
-  HAL_DMA2D_DeInit(&DMA2D_Handle);
+  /* Same register layout as HAL_DMA2D_Init() / HAL_DMA2D_ConfigLayer() */
+  if ((job->FgColorMode == DMA2D_INPUT_A8) || (job->FgColorMode == DMA2D_INPUT_A4))
+  {
+    fg_alpha = job->FgAlpha & DMA2D_FGPFCCR_ALPHA;
+  }
+  else
+  {
+    fg_alpha = job->FgAlpha << DMA2D_FGPFCCR_ALPHA_Pos;
+  }
+  if (job->FgClut != NULL)
+  {
+    /* Number of entries - 1, ARGB8888 entries */
+    clut_size = ((job->FgColorMode == DMA2D_INPUT_L4) || (job->FgColorMode == DMA2D_INPUT_AL44)) ? 15 : 255;
+  }
+  regs.cr = job->Mode;
+  regs.fgpfccr = job->FgColorMode | (job->FgAlphaMode << DMA2D_FGPFCCR_AM_Pos) |
+                 (job->FgRedBlueSwap << DMA2D_FGPFCCR_RBS_Pos) | fg_alpha |
+                 (clut_size << DMA2D_FGPFCCR_CS_Pos) | (DMA2D_CCM_ARGB8888 << DMA2D_FGPFCCR_CCM_Pos);
+  regs.fgcolr = job->FgAlpha & (DMA2D_FGCOLR_BLUE | DMA2D_FGCOLR_GREEN | DMA2D_FGCOLR_RED);
+  regs.fgmar = job->FgAddress;
+  regs.fgor = job->FgOffset;
+  regs.fgcmar = (uint32_t)job->FgClut;
+  regs.bgpfccr = job->BgColorMode;
+  regs.bgmar = job->BgAddress;
+  regs.bgor = job->BgOffset;
+  regs.opfccr = job->OutColorMode;
+  regs.ocolr = DMA2D_OutputColor(job->OutColor, job->OutColorMode);
+  regs.omar = job->OutAddress;
+  regs.oor = job->OutOffset;
+  regs.nlr = job->Height | ((uint32_t)job->Width << DMA2D_NLR_PL_Pos);
+
+  while ((dma2d_submitted - dma2d_completed) >= DMA2D_QUEUE_LENGTH)
+  {
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  dma2d_ring[dma2d_submitted % DMA2D_QUEUE_LENGTH] = regs;
+  fence = ++dma2d_submitted;
+  if (!dma2d_running && !ImgResize_DMA2DBusy())
+  {
+    DMA2D_QueueProgram(&dma2d_ring[dma2d_completed % DMA2D_QUEUE_LENGTH]);
+  }
+  __set_PRIMASK(primask);
+
+  return fence;
+}
+
+/**
+ * @brief Queues a copy from a packed buffer to an area of a larger buffer, with
+ * optional pixel format conversion and red/blue channel swap (same parameters
+ * as DMA2D_MEMCOPY)
+ *
+ * @return fence of the job
+ */
+DMA2D_Fence_t DMA2D_QueueCopy(uint32_t *pSrc, uint32_t *pDst, uint16_t x, uint16_t y,
+                              uint16_t xsize, uint16_t ysize, uint32_t rowStride,
+                              uint32_t input_color_format, uint32_t output_color_format,
+                              int pfc, int red_blue_swap, const uint32_t *pClut)
+{
+  DMA2D_Job_t job = {0};
+
+  job.Mode = pfc ? DMA2D_M2M_PFC : DMA2D_M2M;
+  job.FgAddress = (uint32_t)pSrc;
+  job.FgColorMode = input_color_format;
+  job.FgAlphaMode = DMA2D_REPLACE_ALPHA;
+  job.FgAlpha = 0xFF;
+  job.FgRedBlueSwap = red_blue_swap ? DMA2D_RB_SWAP : DMA2D_RB_REGULAR;
+  job.FgClut = pClut;
+  job.OutAddress = (uint32_t)pDst + (y * rowStride + x) * GetBytesPerPixel(output_color_format);
+  job.OutOffset = rowStride - xsize;
+  job.OutColorMode = output_color_format;
+  job.Width = xsize;
+  job.Height = ysize;
+
+  return DMA2D_QueueSubmit(&job);
+}
+
+/**
+ * @brief Queues a fill of an area with a color
+ *
+ * @param pDst address of the destination buffer
+ * @param x x position in the destination
+ * @param y y position in the destination
+ * @param xsize width of the area
+ * @param ysize height of the area
+ * @param rowStride width of the destination
+ * @param output_color_format destination color format (e.g DMA2D_OUTPUT_ARGB8888)
+ * @param color ARGB8888 color
+ * @return fence of the job
+ */
+DMA2D_Fence_t DMA2D_QueueFill(uint32_t *pDst, uint16_t x, uint16_t y, uint16_t xsize,
+                              uint16_t ysize, uint32_t rowStride,
+                              uint32_t output_color_format, uint32_t color)
+{
+  DMA2D_Job_t job = {0};
+
+  job.Mode = DMA2D_R2M;
+  job.OutAddress = (uint32_t)pDst + (y * rowStride + x) * GetBytesPerPixel(output_color_format);
+  job.OutOffset = rowStride - xsize;
+  job.OutColorMode = output_color_format;
+  job.OutColor = color;
+  job.Width = xsize;
+  job.Height = ysize;
+
+  return DMA2D_QueueSubmit(&job);
+}
+
+/**
+ * @brief Queues the blending of a packed foreground buffer over an area of a
+ * larger buffer, in place
+ *
+ * @param pFg address of the foreground buffer
+ * @param fg_color_format foreground color format (e.g DMA2D_INPUT_A8)
+ * @param fg_alpha foreground alpha multiplier, or ARGB8888 color (color and alpha
+ * multiplier) for A8 and A4 foregrounds
+ * @param pDst address of the destination buffer, also the background
+ * @param x x position in the destination
+ * @param y y position in the destination
+ * @param xsize width of the foreground
+ * @param ysize height of the foreground
+ * @param rowStride width of the destination
+ * @param output_color_format destination color format (e.g DMA2D_OUTPUT_ARGB8888)
+ * @return fence of the job
+ */
+DMA2D_Fence_t DMA2D_QueueBlend(uint32_t *pFg, uint32_t fg_color_format, uint32_t fg_alpha,
+                               uint32_t *pDst, uint16_t x, uint16_t y, uint16_t xsize,
+                               uint16_t ysize, uint32_t rowStride,
+                               uint32_t output_color_format)
+{
+  DMA2D_Job_t job = {0};
+  uint32_t area = (uint32_t)pDst + (y * rowStride + x) * GetBytesPerPixel(output_color_format);
 
-  /*##-1- Configure the DMA2D Mode, Color Mode and output offset #############*/
-  DMA2D_Handle.Init.Mode = pfc ? DMA2D_M2M_PFC : DMA2D_M2M;
-  DMA2D_Handle.Init.ColorMode = output_color_format;
+  job.Mode = DMA2D_M2M_BLEND;
+  job.FgAddress = (uint32_t)pFg;
+  job.FgColorMode = fg_color_format;
+  job.FgAlphaMode = DMA2D_COMBINE_ALPHA;
+  job.FgAlpha = fg_alpha;
+  job.BgAddress = area;
+  job.BgOffset = rowStride - xsize;
+  job.BgColorMode = output_color_format; /* Output and input modes share their values */
+  job.OutAddress = area;
+  job.OutOffset = rowStride - xsize;
+  job.OutColorMode = output_color_format;
+  job.Width = xsize;
+  job.Height = ysize;
 
-  /* Output offset in pixels == nb of pixels to be added at end of line to come to the  */
-  /* first pixel of the next line : on the output side of the DMA2D computation         */
-  DMA2D_Handle.Init.OutputOffset = rowStride - xsize;
+  return DMA2D_QueueSubmit(&job);
+}
 
-  /*##-2- DMA2D Callbacks Configuration ######################################*/
-  DMA2D_Handle.XferCpltCallback = NULL;
+/**
+ * @brief Returns the fence of the last queued DMA2D job
+ *
+ * @return fence, done once every job queued so far is complete
+ */
+DMA2D_Fence_t DMA2D_QueueLastFence(void)
+{
+  return dma2d_submitted;
+}
 
-  /*##-3- Foreground Configuration ###########################################*/
-  DMA2D_Handle.LayerCfg[1].AlphaMode = DMA2D_REPLACE_ALPHA;
-  DMA2D_Handle.LayerCfg[1].InputAlpha = 0xFF;
-  DMA2D_Handle.LayerCfg[1].InputColorMode = input_color_format;
-  DMA2D_Handle.LayerCfg[1].InputOffset = 0;
-  DMA2D_Handle.LayerCfg[1].RedBlueSwap = red_blue_swap ? DMA2D_RB_SWAP : DMA2D_RB_REGULAR;
-  DMA2D_Handle.Instance = DMA2D;
+/**
+ * @brief Tells whether a DMA2D job (and all jobs queued before it) is complete
+ *
+ * @param fence fence of the job
+ * @return 1 if complete, else 0
+ */
+int DMA2D_FenceDone(DMA2D_Fence_t fence)
+{
+  return (int32_t)(dma2d_completed - fence) >= 0;
+}
 
-  /* DMA2D Initialization */
-  if (HAL_DMA2D_Init(&DMA2D_Handle) == HAL_OK)
+/**
+ * @brief Waits for a DMA2D job (and all jobs queued before it) to complete
+ *
+ * @param fence fence of the job
+ */
+void DMA2D_FenceWait(DMA2D_Fence_t fence)
+{
+  while (!DMA2D_FenceDone(fence))
+  {
+  }
+}
+
+/**
+ * @brief Returns the number of DMA2D jobs which ended with a transfer or
+ * configuration error (their fences are signaled anyway)
+ *
+ * @return error count
+ */
+uint32_t DMA2D_QueueGetErrors(void)
+{
+  return dma2d_errors;
+}
+
+/**
+ * @brief Returns the time the DMA2D spent running queue jobs, from the start of
+ * the first job to the end of the last one of each busy period
+ *
+ * @return busy time in cycles (SCHED_Now() time base)
+ */
+uint64_t DMA2D_QueueGetBusyCycles(void)
+{
+  const uint32_t primask = __get_PRIMASK();
+  uint64_t cycles;
+
+  __disable_irq();
+  cycles = dma2d_busy_cycles;
+  if (dma2d_running)
+  {
+    cycles += SCHED_Now() - dma2d_busy_start;
+  }
+  __set_PRIMASK(primask);
+
+  return cycles;
+}
+
+/**
+ * @brief Starts the queued DMA2D jobs held back by a DMA2D resize, to be called
+ * once the resize is complete (from the DMA2D interrupt)
+ *
+ */
+void DMA2D_QueueResume(void)
+{
+  /* The resize reprogrammed the DMA2D */
+  dma2d_shadow_valid = 0;
+  if (!dma2d_running && (dma2d_submitted != dma2d_completed))
+  {
+    DMA2D_QueueProgram(&dma2d_ring[dma2d_completed % DMA2D_QUEUE_LENGTH]);
+  }
+}
+
+/**
+ * @brief Lets a DMA2D resize start only while no queue job runs: the resize
+ * takes the DMA2D interrupt, and would swallow the completion of the job (or of
+ * its CLUT loading, during which DMA2D_CR_START is clear). Called by
+ * ImgResize_DMA2D() with the interrupts disabled.
+ *
+ * @return 1 if the queue is idle, else 0
+ */
+int ImgResize_DMA2DAvailable(void)
+{
+  return !dma2d_running;
+}
+
+/**
+ * @brief Lets the BSP drawing routines use the DMA2D once the queue is empty
+ * and no DMA2D resize runs
+ *
+ */
+void BSP_LCD_DMA2D_WaitIdle(void)
+{
+  DMA2D_FenceWait(dma2d_submitted);
+  while (ImgResize_DMA2DBusy())
+  {
+  }
+  dma2d_shadow_valid = 0;
+}
+
+/**
+ * @brief DMA2D interrupt handler: completes the running job and starts the next
+ * one. Interrupts of other DMA2D users (queue idle) go to the HAL handler.
+ *
+ */
+void LCD_DMA2D_IRQHandler(void)
+{
+  uint32_t isr = DMA2D->ISR & (DMA2D_ISR_TCIF | DMA2D_ISR_TEIF | DMA2D_ISR_CEIF | DMA2D_ISR_CTCIF | DMA2D_ISR_CAEIF);
+
+  if (!dma2d_running)
+  {
+    HAL_DMA2D_IRQHandler(&hdma2d_discovery);
+    return;
+  }
+  if (isr == 0)
   {
-    if (HAL_DMA2D_ConfigLayer(&DMA2D_Handle, 1) == HAL_OK)
+    return;
+  }
+
+  DMA2D->IFCR = isr;
+  if ((isr & (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF | DMA2D_ISR_CAEIF)) != 0)
+  {
+    dma2d_errors++;
+    dma2d_shadow_valid = 0;
+  }
+  else if (dma2d_clut_loading)
+  {
+    if ((isr & DMA2D_ISR_CTCIF) != 0)
     {
-      if (HAL_DMA2D_Start(&DMA2D_Handle, source, destination, xsize, ysize) == HAL_OK)
-      {
-        /* Polling For DMA transfer */
-        HAL_DMA2D_PollForTransfer(&DMA2D_Handle, 30);
-      }
+      /* CLUT loaded, start the transfer */
+      dma2d_clut_loading = 0;
+      DMA2D->CR |= DMA2D_CR_START;
+    }
+    return;
+  }
+  dma2d_clut_loading = 0;
+
+  if (++dma2d_completed != dma2d_submitted)
+  {
+    DMA2D_QueueProgram(&dma2d_ring[dma2d_completed % DMA2D_QUEUE_LENGTH]);
+  }
+  else
+  {
+    /* Leave the DMA2D to polling users */
+    DMA2D->CR &= ~DMA2D_QUEUE_IT;
+    dma2d_running = 0;
+    dma2d_busy_cycles += SCHED_Now() - dma2d_busy_start;
+  }
+}
+
+/**
+ * @brief Programs and starts a DMA2D job, writing only the registers which differ
+ * from the previous queue job (and only those used by its mode). A job with a CLUT
+ * not loaded yet first starts its loading, the transfer being started from the
+ * CLUT transfer complete interrupt.
+ *
+ * @param regs job register image
+ */
+static void DMA2D_QueueProgram(const DMA2D_Regs_t *regs)
+{
+  /* Known CLUT content is lost along with the shadow */
+  const int clut_load = (regs->cr != DMA2D_R2M) && (regs->fgcmar != 0) &&
+                        (!dma2d_shadow_valid || (dma2d_shadow.fgcmar != regs->fgcmar) ||
+                         (dma2d_clut_size != (regs->fgpfccr & DMA2D_FGPFCCR_CS)));
+
+#define DMA2D_UPDATE(REG, field)                                          \
+  do                                                                      \
+  {                                                                       \
+    if (!dma2d_shadow_valid || (dma2d_shadow.field != regs->field))       \
+    {                                                                     \
+      DMA2D->REG = regs->field;                                           \
+      dma2d_shadow.field = regs->field;                                   \
+    }                                                                     \
+  } while (0)
+
+  if (regs->cr == DMA2D_R2M)
+  {
+    DMA2D_UPDATE(OCOLR, ocolr);
+  }
+  else
+  {
+    DMA2D_UPDATE(FGPFCCR, fgpfccr);
+    DMA2D_UPDATE(FGCOLR, fgcolr);
+    DMA2D_UPDATE(FGMAR, fgmar);
+    DMA2D_UPDATE(FGOR, fgor);
+    if (regs->fgcmar != 0)
+    {
+      DMA2D_UPDATE(FGCMAR, fgcmar);
     }
+    if (regs->cr == DMA2D_M2M_BLEND)
+    {
+      DMA2D_UPDATE(BGPFCCR, bgpfccr);
+      DMA2D_UPDATE(BGMAR, bgmar);
+      DMA2D_UPDATE(BGOR, bgor);
+    }
+  }
+  DMA2D_UPDATE(OPFCCR, opfccr);
+  DMA2D_UPDATE(OMAR, omar);
+  DMA2D_UPDATE(OOR, oor);
+  DMA2D_UPDATE(NLR, nlr);
+#undef DMA2D_UPDATE
+
+  /* Registers skipped for this mode keep their shadow values */
+  if (!dma2d_shadow_valid)
+  {
+    dma2d_shadow = *regs;
+    dma2d_shadow.fgpfccr = DMA2D->FGPFCCR;
+    dma2d_shadow.fgcolr = DMA2D->FGCOLR;
+    dma2d_shadow.fgmar = DMA2D->FGMAR;
+    dma2d_shadow.fgor = DMA2D->FGOR;
+    dma2d_shadow.bgpfccr = DMA2D->BGPFCCR;
+    dma2d_shadow.bgmar = DMA2D->BGMAR;
+    dma2d_shadow.bgor = DMA2D->BGOR;
+    dma2d_shadow.ocolr = DMA2D->OCOLR;
+    dma2d_shadow_valid = 1;
+  }
+
+  if (!dma2d_running)
+  {
+    dma2d_busy_start = SCHED_Now();
+  }
+  dma2d_running = 1;
+  if (clut_load)
+  {
+    dma2d_clut_loading = 1;
+    dma2d_clut_size = regs->fgpfccr & DMA2D_FGPFCCR_CS;
+    DMA2D->CR = regs->cr | DMA2D_QUEUE_IT;
+    DMA2D->FGPFCCR = regs->fgpfccr | DMA2D_FGPFCCR_START;
+  }
+  else
+  {
+    DMA2D->CR = regs->cr | DMA2D_QUEUE_IT | DMA2D_CR_START;
+  }
+}
+
+/**
+ * @brief Converts an ARGB8888 color to the DMA2D output color register format,
+ * as HAL_DMA2D_Start() does
+ *
+ * @param color ARGB8888 color
+ * @param output_color_format output color mode
+ * @return OCOLR value
+ */
+static uint32_t DMA2D_OutputColor(uint32_t color, uint32_t output_color_format)
+{
+  const uint32_t a = (color >> 24) & 0xFF;
+  const uint32_t r = (color >> 16) & 0xFF;
+  const uint32_t g = (color >> 8) & 0xFF;
+  const uint32_t b = color & 0xFF;
+
+  switch (output_color_format)
+  {
+    case DMA2D_OUTPUT_RGB888:
+      return color & 0x00FFFFFF;
+    case DMA2D_OUTPUT_RGB565:
+      return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+    case DMA2D_OUTPUT_ARGB1555:
+      return ((a >> 7) << 15) | ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3);
+    case DMA2D_OUTPUT_ARGB4444:
+      return ((a >> 4) << 12) | ((r >> 4) << 8) | ((g >> 4) << 4) | (b >> 4);
+    default:
+      return color;
   }
 }
 
@@ -8,7 +8,7 @@ static void Error_Handler(void);
 static void UART_Init(void);
 static void CAMERA_Init(void);
 static void LED_Init(void);
-static void WaitCameraFrame(void);
+static void WaitCameraFrame(CAMERA_FrameTypeDef *frame);
 void BSP_LCDEx_PrintfAtLineCenter(uint16_t line, const char *format, ...);
 
 /* For printf  */
@@ -16,14 +16,27 @@ UART_HandleTypeDef huart1;
 
 /* Private variables ---------------------------------------------------------*/
 static volatile uint8_t new_frame_ready = 0;
-static uint32_t camera_timing = 0; /*  For fps computation */
 
-/* Frame buffers */
-__attribute__((aligned(16)))
-uint16_t camera_frame_buff[CAM_RES_WIDTH * CAM_RES_HEIGHT];
+/* Stage budgets (us), overruns being reported by the scheduler */
+#define CONVERT_BUDGET_US 5000
+#define DISPLAY_BUDGET_US 10000
 
-__attribute__((aligned(16)))
-uint8_t gray_frame_buff[CAM_RES_WIDTH * CAM_RES_HEIGHT];
+/* Frame buffers (external SDRAM), captured in turn while one is processed */
+#define CAMERA_NB_FRAME_BUFFERS 3
+__attribute__((section(".Camera_Frame"), aligned(32)))
+uint16_t camera_frame_buff[CAMERA_NB_FRAME_BUFFERS][CAM_RES_WIDTH * CAM_RES_HEIGHT];
+
+#if IMG_BENCH
+/* Memory of the image processing micro-benchmarks (external SDRAM) */
+__attribute__((section(".Camera_Frame"), aligned(32)))
+static uint8_t img_bench_buff[IMG_BENCH_BUFFER_SIZE];
+#endif
+
+#if LCD_CAMERA_LAYER_MODE
+/* Grayscale camera image, read by the DMA2D to fill the camera layer */
+__attribute__((aligned(32)))
+static uint8_t camera_gray_buff[CAM_RES_WIDTH * CAM_RES_HEIGHT];
+#endif
 
 int main(void)
 {
@@ -39,6 +52,12 @@ int main(void)
   /* Configure the system clock to 400 MHz */
   SystemClock_Config();
 
+  /* Start the frame scheduler time base */
+  SCHED_Init();
+  SCHED_SetBudget(SCHED_STAGE_CONVERT, CONVERT_BUDGET_US);
+  SCHED_SetBudget(SCHED_STAGE_DISPLAY, DISPLAY_BUDGET_US);
+  MICROTRACE_INIT();
+
   /* Enable CRC HW IP block (needed by Cube.AI) */
   __HAL_RCC_CRC_CLK_ENABLE();
 
@@ -52,6 +71,19 @@ int main(void)
   /* Init UART (used for printf)*/
   UART_Init();
 
+#if IMG_BENCH
+  /* Benchmark report on USART1 instead of the application, none of it lost */
+  UART_TX_SetPolicy(UART_TX_BLOCK);
+  /* DMA2D clock and interrupt, for the DMA2D resize cases */
+  LCD_Init();
+  ImgBenchRun(img_bench_buff, sizeof(img_bench_buff));
+  UART_TX_Flush();
+  BSP_LED_On(LED_GREEN);
+  while (1)
+  {
+  }
+#endif
+
   /* Configure the Wakeup push-button in GPIO Mode */
   BSP_PB_Init(BUTTON_WAKEUP, BUTTON_MODE_GPIO);
 
@@ -60,69 +92,111 @@ int main(void)
 
   /* Initialize the LCD */
   LCD_Init();
-  BSP_LCD_Clear(LCD_COLOR_BLACK);
+  BSP_LCD_Clear(LCD_UI_BACKGROUND);
+#if LCD_CAMERA_LAYER_MODE
+  LCD_CameraLayerInit(0, 0, CAM_RES_WIDTH, CAM_RES_HEIGHT);
+  DMA2D_Fence_t gray_fence = 0;
+#endif
 
   /* Initialize the Camera */
   CAMERA_Init();
+  STATS_Init();
+  uint8_t overlay = STATS_OVERLAY;
+  uint32_t button_last = 0;
 
   for (;;)
   {
+    CAMERA_FrameTypeDef frame;
+    uint32_t now;
 
-    WaitCameraFrame();
+    /*  Each stage boundary is timed once, by the scheduler */
+    STATS_FrameStart(SCHED_FrameStart());
+    WaitCameraFrame(&frame);
+    STATS_StageEnd(STATS_STAGE_CAPTURE_WAIT, SCHED_StageEnd(SCHED_STAGE_ACQUIRE));
+
+    /*  Wakeup button: shows / hides the statistics overlay */
+    const uint32_t button = BSP_PB_GetState(BUTTON_WAKEUP);
+    if (button && !button_last)
+    {
+      overlay = !overlay;
+      STATS_SetOverlay(overlay);
+    }
+    button_last = button;
+
+    /*  Behind schedule: give the frame back without displaying it */
+    if (!SCHED_ShouldDisplay())
+    {
+      BSP_CAMERA_ReleaseFrame(&frame);
+      STATS_FrameEnd(0, SCHED_FrameEnd(0));
+      continue;
+    }
 
     /* Create a camera image */
     Image_t cameraImg = {.width = CAM_RES_WIDTH,
                          .height = CAM_RES_HEIGHT,
-                         .pData = camera_frame_buff,
+                         .pData = frame.pData,
                          .format = PXFMT_RGB565};
 
-    /* Create a grayscale image  */
+#if LCD_CAMERA_LAYER_MODE
+    /*  Grayscale conversion at camera resolution, the DMA2D scales it to the */
+    /*  camera layer (once done with the previous image) */
     Image_t grayImg = {.width = CAM_RES_WIDTH,
                        .height = CAM_RES_HEIGHT,
-                       .pData = gray_frame_buff,
+                       .pData = camera_gray_buff,
                        .format = PXFMT_GRAY8};
 
-    /* Perform color conversion */
+    STATS_StageBegin(STATS_STAGE_CONVERT, SCHED_StageBegin(SCHED_STAGE_CONVERT));
+    DMA2D_FenceWait(gray_fence);
     ImgToGrayscale(&cameraImg, &grayImg);
+    STATS_StageEnd(STATS_STAGE_CONVERT, SCHED_Now());
 
-    /*  Resume  camera  acquisition */
-    BSP_CAMERA_Resume();
+    /*  Give the buffer back to the camera capture */
+    BSP_CAMERA_ReleaseFrame(&frame);
+    SCHED_StageEnd(SCHED_STAGE_CONVERT);
 
-    /*  Display image to LCD buffer with 2x upsampling*/
-    /*  (DMA2D doens't support Grayscale input) */
-    uint32_t *lcd_buffer = (uint32_t *) get_lcd_frame_write_buff();
-    uint8_t *image_buffer = (uint8_t *) grayImg.pData;
-    int rowlcd = 0;
-    int collcd = 0;
-    for (int row = 0; row < CAM_RES_HEIGHT; row++)
-    {
-      for (int col = 0; col < CAM_RES_WIDTH; col++)
-      {
-        uint8_t r8 = *image_buffer;
-        uint8_t g8 = *image_buffer;
-        uint8_t b8 = *image_buffer;
-        image_buffer++;
-        uint32_t argb_pix = 0xFF000000 | (r8 << 16) | (g8 << 8) | b8;
-        lcd_buffer[rowlcd * LCD_RES_WIDTH + collcd] = argb_pix;
-        lcd_buffer[rowlcd * LCD_RES_WIDTH + collcd + 1] = argb_pix;
-        lcd_buffer[(rowlcd + 1) * LCD_RES_WIDTH + collcd] = argb_pix;
-        lcd_buffer[(rowlcd + 1) * LCD_RES_WIDTH + collcd + 1] = argb_pix;
-        collcd += 2;
-      }
-      collcd = 0;
-      rowlcd += 2;
-    }
+    STATS_StageBegin(STATS_STAGE_BLIT, SCHED_StageBegin(SCHED_STAGE_DISPLAY));
+    gray_fence = LCD_CameraLayerWriteGray(camera_gray_buff);
+    now = SCHED_Now();
+    STATS_StageEnd(STATS_STAGE_BLIT, now);
+#else
+    /* LCD write buffer, the upscaled frame lands in its top-left corner */
+    /* (overwritten entirely, the previous frame need not be copied there) */
+    SCHED_StageBegin(SCHED_STAGE_CONVERT);
+    LCD_WillOverwriteRect(0, 0, 2 * CAM_RES_WIDTH, 2 * CAM_RES_HEIGHT);
+    Image_t lcdImg = {.width = LCD_RES_WIDTH,
+                      .height = LCD_RES_HEIGHT,
+                      .pData = get_lcd_frame_write_buff(),
+                      .format = PXFMT_ARGB8888};
+
+    /*  Grayscale conversion and 2x upsampling to the LCD buffer in one pass */
+    /*  (the DMA2D reads GRAY8 through an L8 CLUT, but cannot scale) */
+    STATS_StageBegin(STATS_STAGE_CONVERT, SCHED_Now());
+    ImgToARGB8888Scaled(&cameraImg, &lcdImg, NULL);
+    LCD_AddDirtyRect(0, 0, 2 * CAM_RES_WIDTH, 2 * CAM_RES_HEIGHT);
+    STATS_StageEnd(STATS_STAGE_CONVERT, SCHED_Now());
+
+    /*  Give the buffer back to the camera capture */
+    BSP_CAMERA_ReleaseFrame(&frame);
+    SCHED_StageEnd(SCHED_STAGE_CONVERT);
+    now = SCHED_StageBegin(SCHED_STAGE_DISPLAY);
+#endif
 
-    /*  Compute display FPS */
-    float fps = 1000.0 / (float) (HAL_GetTick() - camera_timing);
-    camera_timing = HAL_GetTick();
+    /*  Display FPS, from the cycle counter */
+    STATS_StageBegin(STATS_STAGE_OVERLAY, now);
+    float fps = SCHED_GetDisplayRate();
     /*  Add additionnal info */
     BSP_LCDEx_PrintfAtLineCenter(2, "%.2f FPS", fps);
+    STATS_DrawOverlay();
     /*  Printf to UART */
     printf("%.2f FPS\r\n", fps);
+    now = SCHED_Now();
+    STATS_StageEnd(STATS_STAGE_OVERLAY, now);
 
-    /*  Refresh LCD screen (copy write buffer to read buffer) */
+    /*  Queue the LCD write buffer for display on the next vertical blanking */
+    STATS_StageBegin(STATS_STAGE_REFRESH, now);
     LCD_Refresh();
+    STATS_StageEnd(STATS_STAGE_REFRESH, SCHED_StageEnd(SCHED_STAGE_DISPLAY));
+    STATS_FrameEnd(1, SCHED_FrameEnd(1));
   }
 }
 
@@ -157,8 +231,14 @@ static void CAMERA_Init(void)
   if (BSP_CAMERA_Init(CAMERA_RESOLUTION) != CAMERA_OK)
     Error_Handler();
 
-  /* Start the camera capture */
-  BSP_CAMERA_ContinuousStart((uint8_t *) camera_frame_buff);
+  /* Start the camera capture in the frame buffers queue */
+  uint8_t *buffers[CAMERA_NB_FRAME_BUFFERS];
+  for (uint32_t i = 0; i < CAMERA_NB_FRAME_BUFFERS; i++)
+  {
+    buffers[i] = (uint8_t *) camera_frame_buff[i];
+  }
+  if (BSP_CAMERA_QueueStart(buffers, CAMERA_NB_FRAME_BUFFERS) != CAMERA_OK)
+    Error_Handler();
 
   /* Wait for the camera initialization after HW reset */
   HAL_Delay(20);
@@ -172,10 +252,8 @@ static void CAMERA_Init(void)
 void BSP_CAMERA_FrameEventCallback(void)
 {
   /*Notifies the backgound task about new frame available for processing*/
+  SCHED_CameraFrameEvent();
   new_frame_ready = 1;
-
-  /*Suspend acquisition of the data stream coming from camera*/
-  BSP_CAMERA_Suspend();
 }
 
 /**
@@ -395,7 +473,7 @@ static void MPU_Config(void)
 void UART_Init(void)
 {
   huart1.Instance = USART1;
-  huart1.Init.BaudRate = 115200;
+  huart1.Init.BaudRate = UART_TX_BAUDRATE;
   huart1.Init.WordLength = UART_WORDLENGTH_8B;
   huart1.Init.StopBits = UART_STOPBITS_1;
   huart1.Init.Parity = UART_PARITY_NONE;
@@ -424,6 +502,9 @@ void UART_Init(void)
   {
     Error_Handler();
   }
+
+  /* printf output, sent by DMA in the background */
+  UART_TX_Init(&huart1);
 }
 
 void BSP_CAMERA_ErrorCallback(void)
@@ -435,21 +516,68 @@ void BSP_CAMERA_ErrorCallback(void)
 
 int _write(int fd, const void *buff, int count)
 {
-  HAL_StatusTypeDef status;
-
   if ((count < 0) && (fd != STDOUT_FILENO) && (fd != STDERR_FILENO))
   {
     errno = EBADF;
     return -1;
   }
-  status = HAL_UART_Transmit(&huart1, (uint8_t *) buff, count, HAL_MAX_DELAY);
-  return (status == HAL_OK ? count : 0);
+  /* Queued without waiting, the overflow policy deciding of the bytes that do
+   * not fit: all of them are consumed, for the C library not to retry */
+  UART_TX_Write(buff, count);
+  return count;
 }
 
-static void WaitCameraFrame(void)
+/**
+ * @brief Microtrace ring mode output: queues the stream data with the printf
+ * output, when it fits entirely
+ *
+ * @param pData stream data
+ * @param size size in bytes
+ * @return 1 if the data was queued, the stream buffer being free again, 0 if
+ * there is not enough room yet
+ */
+int microtrace_stream_write(const char *pData, uint32_t size)
 {
-  while (new_frame_ready == 0)
+  if (UART_TX_GetFree() < size)
   {
+    return 0;
+  }
+  UART_TX_Write(pData, size);
+  MICROTRACE_STREAM_DONE();
+  return 1;
+}
+
+/**
+ * @brief End of a USART1 DMA transmission
+ *
+ * @param huart UART handle
+ */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  UART_TX_CpltCallback(huart);
+}
+
+static void WaitCameraFrame(CAMERA_FrameTypeDef *frame)
+{
+  for (;;)
+  {
+    while (new_frame_ready == 0)
+    {
+      /* Idle: stream the trace events in the background */
+      MICROTRACE_STREAM_POLL();
+    }
+    new_frame_ready = 0;
+
+    /* Latest captured frame, older ones are dropped */
+    if (BSP_CAMERA_AcquireFrame(frame) == CAMERA_OK)
+    {
+      if (!SCHED_FrameIsStale())
+      {
+        return;
+      }
+      /* The next frame is due sooner than this one's age */
+      BSP_CAMERA_ReleaseFrame(frame);
+    }
   }
 }
 
@@ -0,0 +1,373 @@
+/**
+ ******************************************************************************
+ * @file    scheduler.c
+ * @brief   Frame scheduler: cycle counter timestamps of the camera, display
+ *          and pipeline stage events, frame drop / display skip decisions and
+ *          frame time budget accounting
+ ******************************************************************************
+ */
+#include "main.h"
+
+/* Private variables ---------------------------------------------------------*/
+/* Stage statistics, and latency of the displayed frames (from the end of their
+ * capture to the end of their frame), since the last report */
+static SCHED_Stats_t sched_stages[SCHED_STAGE_COUNT];
+static SCHED_Stats_t sched_frames;
+static uint32_t sched_stage_start[SCHED_STAGE_COUNT];
+static uint8_t sched_frame_budget_auto = 1;
+
+/* Capture end time of the frame being processed */
+static uint32_t sched_frame_capture = 0;
+
+/* Event timestamps and periods (cycles), written from interrupts */
+static volatile uint32_t sched_vsync_time = 0;
+static volatile uint32_t sched_vsync_period = 0;
+static volatile uint32_t sched_capture_time = 0;
+static volatile uint32_t sched_capture_duration = 0;
+static volatile uint32_t sched_vblank_time = 0;
+static volatile uint32_t sched_vblank_period = 0;
+
+/* Decisions: totals since the last report, and current runs */
+static uint32_t sched_stale_drops = 0;
+static uint32_t sched_stale_run = 0;
+static uint32_t sched_display_skips = 0;
+static uint32_t sched_skip_run = 0;
+static uint32_t sched_last_display = 0;
+static uint32_t sched_display_period = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void SCHED_StatsAdd(SCHED_Stats_t *stats, uint32_t cycles);
+static void SCHED_StatsReset(SCHED_Stats_t *stats);
+static uint32_t SCHED_StatsAvg(const SCHED_Stats_t *stats);
+static uint32_t SCHED_UsToCycles(uint32_t us);
+
+/**
+ * @brief Starts the DWT cycle counter, the time base of the scheduler. Its 32-bit
+ * count wraps around every 10 s at 400 MHz, longer intervals are not measured.
+ *
+ */
+void SCHED_Init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  /* Cortex-M7 DWT software lock */
+  DWT->LAR = 0xC5ACCE55;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for (uint32_t i = 0; i < SCHED_STAGE_COUNT; i++)
+  {
+    SCHED_StatsReset(&sched_stages[i]);
+  }
+  SCHED_StatsReset(&sched_frames);
+}
+
+/**
+ * @brief Returns the current time
+ *
+ * @return cycle counter
+ */
+uint32_t SCHED_Now(void)
+{
+  return DWT->CYCCNT;
+}
+
+/**
+ * @brief Converts a cycle count to microseconds
+ *
+ * @param cycles cycle count
+ * @return duration in microseconds
+ */
+uint32_t SCHED_CyclesToUs(uint32_t cycles)
+{
+  return cycles / (SystemCoreClock / 1000000U);
+}
+
+/**
+ * @brief Sets the budget of a stage, its longer runs being reported as overruns
+ *
+ * @param stage pipeline stage
+ * @param us budget in microseconds, 0 for none
+ */
+void SCHED_SetBudget(SCHED_Stage_t stage, uint32_t us)
+{
+  sched_stages[stage].Budget = SCHED_UsToCycles(us);
+}
+
+/**
+ * @brief Sets the latency budget of the frames, from the end of their capture to
+ * the end of their display update. Defaults to the camera frame period.
+ *
+ * @param us budget in microseconds, 0 for the camera frame period
+ */
+void SCHED_SetFrameBudget(uint32_t us)
+{
+  sched_frame_budget_auto = (us == 0);
+  sched_frames.Budget = SCHED_UsToCycles(us);
+}
+
+/**
+ * @brief Marks the start of a frame, before waiting for the camera
+ *
+ * @return current time, for the other measures of the same boundary
+ */
+uint32_t SCHED_FrameStart(void)
+{
+  return SCHED_StageBegin(SCHED_STAGE_ACQUIRE);
+}
+
+/**
+ * @brief To be called for each acquired camera frame: tells whether to drop it
+ * and wait for the next one. A frame is stale when it was captured more than half
+ * a camera period ago, the next one then being due sooner than its age. At most
+ * SCHED_MAX_STALE_DROPS frames are dropped in a row.
+ *
+ * @return 1 if the frame should be released unprocessed, else 0
+ */
+int SCHED_FrameIsStale(void)
+{
+  const uint32_t period = sched_vsync_period;
+
+  sched_frame_capture = sched_capture_time;
+  if ((period == 0) || (sched_stale_run >= SCHED_MAX_STALE_DROPS) ||
+      ((SCHED_Now() - sched_frame_capture) <= (period / 2)))
+  {
+    sched_stale_run = 0;
+    return 0;
+  }
+
+  sched_stale_run++;
+  sched_stale_drops++;
+  return 1;
+}
+
+/**
+ * @brief Marks the beginning of a stage
+ *
+ * @param stage pipeline stage
+ * @return current time, for the other measures of the same boundary
+ */
+uint32_t SCHED_StageBegin(SCHED_Stage_t stage)
+{
+  const uint32_t now = SCHED_Now();
+
+  sched_stage_start[stage] = now;
+  return now;
+}
+
+/**
+ * @brief Marks the end of a stage, accounting its duration
+ *
+ * @param stage pipeline stage
+ * @return current time, for the other measures of the same boundary
+ */
+uint32_t SCHED_StageEnd(SCHED_Stage_t stage)
+{
+  const uint32_t now = SCHED_Now();
+
+  SCHED_StatsAdd(&sched_stages[stage], now - sched_stage_start[stage]);
+  return now;
+}
+
+/**
+ * @brief Tells whether to update the display with the current frame. The update
+ * is skipped when the frame latency would exceed its budget: time since the end
+ * of the capture, plus average conversion and display durations, plus the wait
+ * for the next vertical blanking if no LCD buffer is free. At most
+ * SCHED_MAX_DISPLAY_SKIPS updates are skipped in a row.
+ *
+ * @return 1 to update the display, 0 to skip the frame
+ */
+int SCHED_ShouldDisplay(void)
+{
+  const uint32_t now = SCHED_Now();
+  uint32_t latency = (now - sched_frame_capture) + SCHED_StatsAvg(&sched_stages[SCHED_STAGE_CONVERT]) +
+                     SCHED_StatsAvg(&sched_stages[SCHED_STAGE_DISPLAY]);
+
+  if (!LCD_WriteBufferReady() && (sched_vblank_period != 0))
+  {
+    latency += (sched_vblank_time + sched_vblank_period) - now;
+  }
+
+  if ((sched_frames.Budget == 0) || (latency <= sched_frames.Budget) ||
+      (sched_skip_run >= SCHED_MAX_DISPLAY_SKIPS))
+  {
+    sched_skip_run = 0;
+    return 1;
+  }
+
+  sched_skip_run++;
+  sched_display_skips++;
+  return 0;
+}
+
+/**
+ * @brief Marks the end of a frame, accounting its latency if it was displayed
+ *
+ * @param displayed whether the display was updated with the frame
+ * @return current time, for the other measures of the same boundary
+ */
+uint32_t SCHED_FrameEnd(int displayed)
+{
+  const uint32_t now = SCHED_Now();
+
+  if (sched_frame_budget_auto)
+  {
+    sched_frames.Budget = sched_vsync_period;
+  }
+
+  if (displayed)
+  {
+    SCHED_StatsAdd(&sched_frames, now - sched_frame_capture);
+    sched_display_period = now - sched_last_display;
+    sched_last_display = now;
+  }
+
+  return now;
+}
+
+/**
+ * @brief Returns the display update rate, from the last two updates
+ *
+ * @return updates per second
+ */
+float SCHED_GetDisplayRate(void)
+{
+  return (sched_display_period != 0) ? ((float)SystemCoreClock / (float)sched_display_period) : 0.0f;
+}
+
+/**
+ * @brief Returns the statistics of a stage since the last report
+ *
+ * @param stage pipeline stage, SCHED_STAGE_COUNT for the frame latencies
+ * @return stage statistics
+ */
+const SCHED_Stats_t *SCHED_GetStats(SCHED_Stage_t stage)
+{
+  return (stage < SCHED_STAGE_COUNT) ? &sched_stages[stage] : &sched_frames;
+}
+
+/**
+ * @brief Prints the event periods, the decisions and the stage statistics since
+ * the last report (durations in microseconds) as a "sched" JSON member, then
+ * starts a new report period. Called by STATS_Report(), within its JSON line.
+ *
+ */
+void SCHED_Report(void)
+{
+  static const char *const names[SCHED_STAGE_COUNT] = {"acquire", "convert", "display"};
+
+  printf("\"sched\":{\"camera_us\":%lu,\"capture_us\":%lu,\"vblank_us\":%lu,\"stale\":%lu,\"skipped\":%lu,"
+         "\"latency\":{\"avg_us\":%lu,\"max_us\":%lu,\"budget_us\":%lu,\"overruns\":%lu}",
+         SCHED_CyclesToUs(sched_vsync_period), SCHED_CyclesToUs(sched_capture_duration),
+         SCHED_CyclesToUs(sched_vblank_period), sched_stale_drops, sched_display_skips,
+         SCHED_CyclesToUs(SCHED_StatsAvg(&sched_frames)), SCHED_CyclesToUs(sched_frames.Max),
+         SCHED_CyclesToUs(sched_frames.Budget), sched_frames.Overruns);
+  for (uint32_t i = 0; i < SCHED_STAGE_COUNT; i++)
+  {
+    const SCHED_Stats_t *stats = &sched_stages[i];
+
+    printf(",\"%s\":{\"avg_us\":%lu,\"max_us\":%lu,\"budget_us\":%lu,\"overruns\":%lu}", names[i],
+           SCHED_CyclesToUs(SCHED_StatsAvg(stats)), SCHED_CyclesToUs(stats->Max),
+           SCHED_CyclesToUs(stats->Budget), stats->Overruns);
+    SCHED_StatsReset(&sched_stages[i]);
+  }
+  printf("}");
+
+  SCHED_StatsReset(&sched_frames);
+  sched_stale_drops = 0;
+  sched_display_skips = 0;
+}
+
+/**
+ * @brief Camera frame event: timestamps the end of a frame capture. To be called
+ * from BSP_CAMERA_FrameEventCallback().
+ *
+ */
+void SCHED_CameraFrameEvent(void)
+{
+  const uint32_t now = SCHED_Now();
+
+  sched_capture_duration = now - sched_vsync_time;
+  sched_capture_time = now;
+}
+
+/**
+ * @brief LTDC vertical blanking event, to be called from the LTDC line interrupt
+ *
+ */
+void SCHED_VblankEvent(void)
+{
+  const uint32_t now = SCHED_Now();
+
+  sched_vblank_period = now - sched_vblank_time;
+  sched_vblank_time = now;
+}
+
+/**
+ * @brief Camera VSYNC event: timestamps the start of a frame capture
+ *
+ */
+void BSP_CAMERA_VsyncEventCallback(void)
+{
+  const uint32_t now = SCHED_Now();
+
+  sched_vsync_period = now - sched_vsync_time;
+  sched_vsync_time = now;
+}
+
+/**
+ * @brief Accounts a run in stage statistics
+ *
+ * @param stats statistics
+ * @param cycles run duration
+ */
+static void SCHED_StatsAdd(SCHED_Stats_t *stats, uint32_t cycles)
+{
+  stats->Count++;
+  stats->Last = cycles;
+  stats->Total += cycles;
+  if (cycles > stats->Max)
+  {
+    stats->Max = cycles;
+  }
+  if ((stats->Budget != 0) && (cycles > stats->Budget))
+  {
+    stats->Overruns++;
+  }
+}
+
+/**
+ * @brief Clears stage statistics, keeping their budget
+ *
+ * @param stats statistics
+ */
+static void SCHED_StatsReset(SCHED_Stats_t *stats)
+{
+  stats->Count = 0;
+  stats->Last = 0;
+  stats->Max = 0;
+  stats->Total = 0;
+  stats->Overruns = 0;
+}
+
+/**
+ * @brief Returns the average run duration of stage statistics
+ *
+ * @param stats statistics
+ * @return average duration in cycles, 0 if no run
+ */
+static uint32_t SCHED_StatsAvg(const SCHED_Stats_t *stats)
+{
+  return (stats->Count != 0) ? (uint32_t)(stats->Total / stats->Count) : 0;
+}
+
+/**
+ * @brief Converts microseconds to a cycle count
+ *
+ * @param us duration in microseconds
+ * @return cycle count
+ */
+static uint32_t SCHED_UsToCycles(uint32_t us)
+{
+  return us * (SystemCoreClock / 1000000U);
+}
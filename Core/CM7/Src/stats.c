@@ -0,0 +1,371 @@
+/**
+ ******************************************************************************
+ * @file    stats.c
+ * @brief   Performance counters: per-stage cycle histograms (min / avg / max /
+ *          p99) from the scheduler timestamps, camera and DMA2D counters,
+ *          periodic JSON report on the UART (with the scheduler statistics)
+ *          and optional on-screen overlay
+ ******************************************************************************
+ */
+#include "main.h"
+#include <string.h>
+
+#if (STATS_HIST_SUB_BUCKETS & (STATS_HIST_SUB_BUCKETS - 1)) != 0 || STATS_HIST_SUB_BUCKETS < 2
+#error "STATS_HIST_SUB_BUCKETS must be a power of 2"
+#endif
+
+/* Log-linear histogram: values below STATS_HIST_SUB_BUCKETS have their own
+ * bucket, each larger power of 2 range is split in STATS_HIST_SUB_BUCKETS */
+#define STATS_HIST_SUB_BITS ((uint32_t)__builtin_ctz(STATS_HIST_SUB_BUCKETS))
+#define STATS_HIST_BUCKETS ((33 - STATS_HIST_SUB_BITS) * STATS_HIST_SUB_BUCKETS)
+
+/* Overlay: Font12 lines at the bottom left of the screen, in a band as wide as
+ * the longest line */
+#define STATS_OVERLAY_FONT Font12
+#define STATS_OVERLAY_LINES (STATS_STAGE_COUNT + 2)
+#define STATS_OVERLAY_CHARS 63
+#define STATS_OVERLAY_HEIGHT (STATS_OVERLAY_LINES * STATS_OVERLAY_FONT.Height)
+
+typedef struct
+{
+  uint32_t Count;
+  uint32_t Min;
+  uint32_t Max;
+  uint64_t Total;
+  uint32_t Hist[STATS_HIST_BUCKETS];
+} STATS_Hist_t;
+
+/* Counters, totals since the startup */
+typedef struct
+{
+  uint32_t Tick;        /* HAL tick (ms)                     */
+  uint32_t Dropped;     /* Camera frames never processed     */
+  uint32_t Overruns;    /* DCMI overruns                     */
+  uint64_t Dma2dBusy;   /* DMA2D queue busy cycles           */
+  uint32_t Dma2dErrors; /* DMA2D job errors                  */
+  uint32_t UartDropped; /* UART output bytes dropped         */
+} STATS_Counters_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const char *const stats_names[STATS_STAGE_COUNT] = {"capture_wait", "convert", "resize", "blit",
+                                                            "refresh",      "overlay", "frame"};
+
+/* Stage histograms, since the last report */
+static STATS_Hist_t stats_hist[STATS_STAGE_COUNT];
+static uint32_t stats_start[STATS_STAGE_COUNT];
+static uint32_t stats_frames = 0;
+static uint32_t stats_displayed = 0;
+
+/* Counters at the last report */
+static STATS_Counters_t stats_last;
+
+/* Last report, drawn by STATS_DrawOverlay() */
+static uint8_t stats_overlay = STATS_OVERLAY;
+static uint8_t stats_overlay_clear = 0;
+static char stats_overlay_text[STATS_OVERLAY_LINES][STATS_OVERLAY_CHARS + 1];
+
+/* Private function prototypes -----------------------------------------------*/
+static void STATS_HistReset(STATS_Hist_t *hist);
+static uint32_t STATS_HistBucket(uint32_t cycles);
+static uint32_t STATS_HistBucketMax(uint32_t bucket);
+static void STATS_GetCounters(STATS_Counters_t *counters);
+
+/**
+ * @brief Clears the statistics and starts the first report period. The cycle
+ * counter must be running (SCHED_Init()).
+ *
+ */
+void STATS_Init(void)
+{
+  for (uint32_t i = 0; i < STATS_STAGE_COUNT; i++)
+  {
+    STATS_HistReset(&stats_hist[i]);
+  }
+  stats_frames = 0;
+  stats_displayed = 0;
+  STATS_GetCounters(&stats_last);
+  stats_overlay_text[0][0] = '\0';
+}
+
+/**
+ * @brief Marks the start of a frame, before waiting for the camera
+ *
+ * @param now SCHED_Now() time, as returned by SCHED_FrameStart()
+ */
+void STATS_FrameStart(uint32_t now)
+{
+  stats_start[STATS_STAGE_FRAME] = now;
+  stats_start[STATS_STAGE_CAPTURE_WAIT] = now;
+}
+
+/**
+ * @brief Marks the beginning of a stage
+ *
+ * @param stage measured stage
+ * @param now SCHED_Now() time, as returned by the scheduler call at the same
+ * boundary if any
+ */
+void STATS_StageBegin(STATS_Stage_t stage, uint32_t now)
+{
+  stats_start[stage] = now;
+}
+
+/**
+ * @brief Marks the end of a stage, adding its duration to the stage histogram
+ *
+ * @param stage measured stage
+ * @param now SCHED_Now() time, as returned by the scheduler call at the same
+ * boundary if any
+ */
+void STATS_StageEnd(STATS_Stage_t stage, uint32_t now)
+{
+  STATS_Hist_t *hist = &stats_hist[stage];
+  const uint32_t cycles = now - stats_start[stage];
+
+  hist->Count++;
+  hist->Total += cycles;
+  hist->Hist[STATS_HistBucket(cycles)]++;
+  if (cycles < hist->Min)
+  {
+    hist->Min = cycles;
+  }
+  if (cycles > hist->Max)
+  {
+    hist->Max = cycles;
+  }
+}
+
+/**
+ * @brief Marks the end of a frame, and reports the statistics every
+ * STATS_REPORT_FRAMES frames
+ *
+ * @param displayed whether the display was updated with the frame
+ * @param now SCHED_Now() time, as returned by SCHED_FrameEnd()
+ */
+void STATS_FrameEnd(int displayed, uint32_t now)
+{
+  STATS_StageEnd(STATS_STAGE_FRAME, now);
+  stats_frames++;
+  if (displayed)
+  {
+    stats_displayed++;
+  }
+
+#if STATS_REPORT_FRAMES > 0
+  if (stats_frames >= STATS_REPORT_FRAMES)
+  {
+    STATS_Report();
+  }
+#endif
+}
+
+/**
+ * @brief Returns the summary of a stage histogram since the last report
+ *
+ * @param stage measured stage
+ * @param summary filled with durations in cycles
+ */
+void STATS_GetSummary(STATS_Stage_t stage, STATS_Summary_t *summary)
+{
+  const STATS_Hist_t *hist = &stats_hist[stage];
+  /* Rank of the 99th percentile, rounded up */
+  const uint32_t rank = hist->Count - hist->Count / 100;
+  uint32_t seen = 0;
+  uint32_t bucket = 0;
+
+  summary->Count = hist->Count;
+  if (hist->Count == 0)
+  {
+    summary->Min = 0;
+    summary->Avg = 0;
+    summary->Max = 0;
+    summary->P99 = 0;
+    return;
+  }
+
+  while ((seen += hist->Hist[bucket]) < rank)
+  {
+    bucket++;
+  }
+  summary->Min = hist->Min;
+  summary->Avg = (uint32_t)(hist->Total / hist->Count);
+  summary->Max = hist->Max;
+  summary->P99 = STATS_HistBucketMax(bucket);
+  if (summary->P99 > hist->Max)
+  {
+    summary->P99 = hist->Max;
+  }
+}
+
+/**
+ * @brief Prints the statistics since the last report as a JSON line (durations
+ * in cycles, at "hz", and the scheduler statistics from SCHED_Report()), updates
+ * the overlay text, then starts a new report period. Stages without runs are
+ * left out.
+ *
+ */
+void STATS_Report(void)
+{
+  const uint32_t mhz = SystemCoreClock / 1000000U;
+  STATS_Counters_t now;
+  STATS_Summary_t summary;
+  uint32_t period_ms;
+  uint32_t busy_us;
+  uint32_t line = 1;
+  const char *sep = "";
+
+  STATS_GetCounters(&now);
+  period_ms = now.Tick - stats_last.Tick;
+  busy_us = (uint32_t)((now.Dma2dBusy - stats_last.Dma2dBusy) / mhz);
+
+  printf("{\"stats\":{\"hz\":%lu,\"period_ms\":%lu,\"frames\":%lu,\"displayed\":%lu,\"dropped\":%lu,"
+         "\"dcmi_overruns\":%lu,\"dma2d_busy_us\":%lu,\"dma2d_errors\":%lu,\"uart_dropped\":%lu,\"stages\":{",
+         SystemCoreClock, period_ms, stats_frames, stats_displayed, now.Dropped - stats_last.Dropped,
+         now.Overruns - stats_last.Overruns, busy_us, now.Dma2dErrors - stats_last.Dma2dErrors,
+         now.UartDropped - stats_last.UartDropped);
+
+  snprintf(stats_overlay_text[0], sizeof(stats_overlay_text[0]), "%-12s %7s %7s %7s %7s (us)", "stage", "min",
+           "avg", "p99", "max");
+  for (uint32_t i = 0; i < STATS_STAGE_COUNT; i++)
+  {
+    STATS_GetSummary((STATS_Stage_t)i, &summary);
+    if (summary.Count != 0)
+    {
+      printf("%s\"%s\":{\"n\":%lu,\"min\":%lu,\"avg\":%lu,\"max\":%lu,\"p99\":%lu}", sep, stats_names[i],
+             summary.Count, summary.Min, summary.Avg, summary.Max, summary.P99);
+      sep = ",";
+      snprintf(stats_overlay_text[line++], sizeof(stats_overlay_text[0]), "%-12s %7lu %7lu %7lu %7lu",
+               stats_names[i], summary.Min / mhz, summary.Avg / mhz, summary.P99 / mhz, summary.Max / mhz);
+    }
+    STATS_HistReset(&stats_hist[i]);
+  }
+  printf("},");
+  SCHED_Report();
+  printf("}}\r\n");
+
+  snprintf(stats_overlay_text[line++], sizeof(stats_overlay_text[0]),
+           "dropped %lu  dcmi ovr %lu  dma2d %lu%%  uart drop %lu", now.Dropped - stats_last.Dropped,
+           now.Overruns - stats_last.Overruns, (period_ms != 0) ? busy_us / (period_ms * 10U) : 0,
+           now.UartDropped - stats_last.UartDropped);
+  if (line < STATS_OVERLAY_LINES)
+  {
+    stats_overlay_text[line][0] = '\0';
+  }
+
+  stats_last = now;
+  stats_frames = 0;
+  stats_displayed = 0;
+}
+
+/**
+ * @brief Enables or disables the overlay drawn by STATS_DrawOverlay()
+ *
+ * @param enable 1 to draw the overlay, 0 for none
+ */
+void STATS_SetOverlay(int enable)
+{
+  stats_overlay = (enable != 0);
+  stats_overlay_clear = !stats_overlay;
+}
+
+/**
+ * @brief Draws the last report at the bottom left of the LCD write buffer, if
+ * the overlay is enabled. To be called for each displayed frame, before
+ * LCD_Refresh(). On the transparent UI layer (LCD_CAMERA_LAYER_MODE), the band
+ * is cleared before each redraw and once the overlay is disabled.
+ *
+ */
+void STATS_DrawOverlay(void)
+{
+  const int draw = stats_overlay && (stats_overlay_text[0][0] != '\0');
+  sFONT *font;
+  uint16_t y = LCD_RES_HEIGHT - STATS_OVERLAY_HEIGHT;
+
+#if LCD_CAMERA_LAYER_MODE
+  if (draw || stats_overlay_clear)
+  {
+    /* Reported as damage by the fill */
+    const uint32_t color = BSP_LCD_GetTextColor();
+    BSP_LCD_SetTextColor(LCD_UI_BACKGROUND);
+    BSP_LCD_FillRect(0, y, STATS_OVERLAY_CHARS * STATS_OVERLAY_FONT.Width, STATS_OVERLAY_HEIGHT);
+    BSP_LCD_SetTextColor(color);
+  }
+#endif
+  stats_overlay_clear = 0;
+
+  if (!draw)
+  {
+    return;
+  }
+
+  font = BSP_LCD_GetFont();
+  BSP_LCD_SetFont(&STATS_OVERLAY_FONT);
+  for (uint32_t i = 0; (i < STATS_OVERLAY_LINES) && (stats_overlay_text[i][0] != '\0'); i++)
+  {
+    BSP_LCD_DisplayStringAt(0, y, (uint8_t *)stats_overlay_text[i], LEFT_MODE);
+    y += STATS_OVERLAY_FONT.Height;
+  }
+  BSP_LCD_SetFont(font);
+}
+
+/**
+ * @brief Clears a stage histogram
+ *
+ * @param hist histogram
+ */
+static void STATS_HistReset(STATS_Hist_t *hist)
+{
+  memset(hist, 0, sizeof(*hist));
+  hist->Min = UINT32_MAX;
+}
+
+/**
+ * @brief Returns the histogram bucket of a duration
+ *
+ * @param cycles duration
+ * @return bucket index
+ */
+static uint32_t STATS_HistBucket(uint32_t cycles)
+{
+  uint32_t shift;
+
+  if (cycles < STATS_HIST_SUB_BUCKETS)
+  {
+    return cycles;
+  }
+  shift = (31U - __CLZ(cycles)) - STATS_HIST_SUB_BITS;
+  return (shift + 1) * STATS_HIST_SUB_BUCKETS + ((cycles >> shift) & (STATS_HIST_SUB_BUCKETS - 1));
+}
+
+/**
+ * @brief Returns the largest duration of a histogram bucket
+ *
+ * @param bucket bucket index
+ * @return duration in cycles
+ */
+static uint32_t STATS_HistBucketMax(uint32_t bucket)
+{
+  uint32_t shift;
+
+  if (bucket < STATS_HIST_SUB_BUCKETS)
+  {
+    return bucket;
+  }
+  shift = bucket / STATS_HIST_SUB_BUCKETS - 1;
+  return (uint32_t)((((uint64_t)STATS_HIST_SUB_BUCKETS + bucket % STATS_HIST_SUB_BUCKETS + 1) << shift) - 1);
+}
+
+/**
+ * @brief Reads the counters of the other modules
+ *
+ * @param counters filled with totals since the startup
+ */
+static void STATS_GetCounters(STATS_Counters_t *counters)
+{
+  counters->Tick = HAL_GetTick();
+  counters->Dropped = BSP_CAMERA_GetDroppedFrames();
+  counters->Overruns = BSP_CAMERA_GetOverruns();
+  counters->Dma2dBusy = DMA2D_QueueGetBusyCycles();
+  counters->Dma2dErrors = DMA2D_QueueGetErrors();
+  counters->UartDropped = UART_TX_GetDropped();
+}
@@ -178,9 +178,47 @@ void DSI_IRQHandler(void)
   HAL_DSI_IRQHandler(&hdsi_discovery);
 }
 
+/**
+  * @brief  This function handles LTDC global interrupt request.
+  * @param  None
+  * @retval None
+  */
+void LTDC_IRQHandler(void)
+{
+  HAL_LTDC_IRQHandler(&hltdc_discovery);
+}
+
 void DMA2D_IRQHandler(void)
 {
-  HAL_DMA2D_IRQHandler(&hdma2d_discovery);
+  if (!ImgResize_DMA2D_IRQHandler())
+  {
+    LCD_DMA2D_IRQHandler();
+  }
+  else if (!ImgResize_DMA2DBusy())
+  {
+    /* Resize done: run the display jobs queued meanwhile */
+    DMA2D_QueueResume();
+  }
+}
+
+/**
+  * @brief  This function handles the USART1 transmit DMA interrupt request.
+  * @param  None
+  * @retval None
+  */
+void UART_TX_DMA_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(huart1.hdmatx);
+}
+
+/**
+  * @brief  This function handles USART1 global interrupt request.
+  * @param  None
+  * @retval None
+  */
+void USART1_IRQHandler(void)
+{
+  HAL_UART_IRQHandler(&huart1);
 }
 
 /**
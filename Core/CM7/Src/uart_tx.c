@@ -0,0 +1,225 @@
+/**
+ ******************************************************************************
+ * @file    uart_tx.c
+ * @brief   Non-blocking UART output: ring buffer drained by DMA in the
+ *          background, behind _write() / printf()
+ ******************************************************************************
+ */
+#include "main.h"
+#include <string.h>
+
+#if (UART_TX_RING_SIZE & (UART_TX_RING_SIZE - 1)) != 0 || UART_TX_RING_SIZE > 32768
+#error "UART_TX_RING_SIZE must be a power of 2 up to 32768"
+#endif
+
+#define UART_TX_MASK (UART_TX_RING_SIZE - 1)
+#define UART_TX_MIN(a, b) (((a) < (b)) ? (a) : (b))
+
+/* Private variables ---------------------------------------------------------*/
+/* Ring buffer (AXI SRAM, reachable by DMA1), with free running indexes: bytes
+ * are queued at head, the next transfer starts at send, and the bytes from tail
+ * are in use until the transfer in progress completes */
+ALIGN_32BYTES(static uint8_t uart_tx_ring[UART_TX_RING_SIZE]);
+static UART_HandleTypeDef *uart_tx_huart = NULL;
+static volatile uint32_t uart_tx_head = 0;
+static volatile uint32_t uart_tx_send = 0;
+static volatile uint32_t uart_tx_tail = 0;
+static volatile uint8_t uart_tx_busy = 0;
+static volatile uint32_t uart_tx_dropped = 0;
+static volatile UART_TX_Policy_t uart_tx_policy = UART_TX_POLICY;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t UART_TX_Queue(const uint8_t *pData, uint32_t size, UART_TX_Policy_t policy);
+static void UART_TX_Start(void);
+
+/**
+ * @brief Attaches the output to a UART, its transmit DMA and interrupts being
+ * set up by HAL_UART_MspInit()
+ *
+ * @param huart initialized UART handle
+ */
+void UART_TX_Init(UART_HandleTypeDef *huart)
+{
+  uart_tx_head = 0;
+  uart_tx_send = 0;
+  uart_tx_tail = 0;
+  uart_tx_busy = 0;
+  uart_tx_dropped = 0;
+  uart_tx_huart = huart;
+}
+
+/**
+ * @brief Sets the overflow policy
+ *
+ * @param policy what to do with output that does not fit in the ring buffer
+ */
+void UART_TX_SetPolicy(UART_TX_Policy_t policy)
+{
+  uart_tx_policy = policy;
+}
+
+/**
+ * @brief Queues bytes for transmission, starting the DMA if it is idle. Returns
+ * without waiting, except with the UART_TX_BLOCK policy in thread mode.
+ *
+ * @param pData bytes to send
+ * @param size number of bytes
+ * @return number of bytes queued, the others being dropped
+ */
+uint32_t UART_TX_Write(const void *pData, uint32_t size)
+{
+  const uint8_t *pBytes = pData;
+  uint32_t queued = 0;
+
+  if (uart_tx_huart == NULL)
+  {
+    return 0;
+  }
+
+  /* Waiting is only possible when the completion interrupt can run */
+  if ((uart_tx_policy == UART_TX_BLOCK) && (__get_IPSR() == 0) && (__get_PRIMASK() == 0))
+  {
+    while (queued < size)
+    {
+      queued += UART_TX_Queue(pBytes + queued, size - queued, UART_TX_BLOCK);
+    }
+    return queued;
+  }
+
+  return UART_TX_Queue(pBytes, size, (uart_tx_policy == UART_TX_OVERWRITE) ? UART_TX_OVERWRITE : UART_TX_DROP);
+}
+
+/**
+ * @brief Returns the room left in the ring buffer
+ *
+ * @return number of bytes that can be queued without loss
+ */
+uint32_t UART_TX_GetFree(void)
+{
+  return UART_TX_RING_SIZE - (uart_tx_head - uart_tx_tail);
+}
+
+/**
+ * @brief Returns the number of bytes dropped since the initialization
+ *
+ * @return dropped bytes (new ones, or old ones with UART_TX_OVERWRITE)
+ */
+uint32_t UART_TX_GetDropped(void)
+{
+  return uart_tx_dropped;
+}
+
+/**
+ * @brief Waits until all queued bytes are sent, in thread mode
+ *
+ */
+void UART_TX_Flush(void)
+{
+  while ((uart_tx_tail != uart_tx_head) || uart_tx_busy)
+  {
+  }
+}
+
+/**
+ * @brief End of a DMA transmission: frees its bytes and starts the next one. To
+ * be called from HAL_UART_TxCpltCallback().
+ *
+ * @param huart UART handle
+ */
+void UART_TX_CpltCallback(UART_HandleTypeDef *huart)
+{
+  if (huart == uart_tx_huart)
+  {
+    uart_tx_tail = uart_tx_send;
+    uart_tx_busy = 0;
+    UART_TX_Start();
+  }
+}
+
+/**
+ * @brief Copies bytes to the ring buffer, as many as fit, and starts the DMA if
+ * it is idle
+ *
+ * @param pData bytes to send
+ * @param size number of bytes
+ * @param policy UART_TX_OVERWRITE to drop the oldest bytes not being sent to
+ * make room while the DMA is idle, then the first new bytes if still needed, or
+ * the last new bytes as UART_TX_DROP during a transfer; UART_TX_DROP to drop
+ * the last new bytes; UART_TX_BLOCK to leave them to the caller
+ * @return number of bytes queued
+ */
+static uint32_t UART_TX_Queue(const uint8_t *pData, uint32_t size, UART_TX_Policy_t policy)
+{
+  const uint32_t primask = __get_PRIMASK();
+  uint32_t room;
+  uint32_t offset;
+  uint32_t first;
+
+  __disable_irq();
+  room = UART_TX_RING_SIZE - (uart_tx_head - uart_tx_tail);
+  if ((policy == UART_TX_OVERWRITE) && (size > room) && !uart_tx_busy)
+  {
+    /* Only frees room while the DMA is idle: during a transfer, the tail stays
+     * at its start */
+    const uint32_t discard = UART_TX_MIN(size - room, uart_tx_head - uart_tx_send);
+
+    uart_tx_send += discard;
+    uart_tx_tail = uart_tx_send;
+    uart_tx_dropped += discard;
+    room += discard;
+    if (size > room)
+    {
+      /* Larger than the ring buffer: keeps the last new bytes */
+      pData += size - room;
+      uart_tx_dropped += size - room;
+      size = room;
+    }
+  }
+  else if (size > room)
+  {
+    if (policy != UART_TX_BLOCK)
+    {
+      uart_tx_dropped += size - room;
+    }
+    size = room;
+  }
+
+  offset = uart_tx_head & UART_TX_MASK;
+  first = UART_TX_MIN(size, UART_TX_RING_SIZE - offset);
+  memcpy(&uart_tx_ring[offset], pData, first);
+  memcpy(uart_tx_ring, pData + first, size - first);
+  uart_tx_head += size;
+
+  if (!uart_tx_busy)
+  {
+    UART_TX_Start();
+  }
+  __set_PRIMASK(primask);
+
+  return size;
+}
+
+/**
+ * @brief Starts the DMA transmission of the queued bytes, up to the end of the
+ * ring buffer. To be called with the interrupts disabled, or from the completion
+ * interrupt.
+ *
+ */
+static void UART_TX_Start(void)
+{
+  const uint32_t offset = uart_tx_send & UART_TX_MASK;
+  const uint32_t size = UART_TX_MIN(uart_tx_head - uart_tx_send, UART_TX_RING_SIZE - offset);
+  uint8_t *pChunk = &uart_tx_ring[offset];
+
+  if (size == 0)
+  {
+    return;
+  }
+
+  SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)pChunk & ~0x1FU), size + ((uint32_t)pChunk & 0x1FU));
+  if (HAL_UART_Transmit_DMA(uart_tx_huart, pChunk, (uint16_t)size) == HAL_OK)
+  {
+    uart_tx_send += size;
+    uart_tx_busy = 1;
+  }
+}
@@ -34,6 +34,14 @@
       - BSP_CAMERA_Suspend()
       - BSP_CAMERA_Resume()
       - BSP_CAMERA_Stop()
+     o Or start a multi-buffer continuous capture with BSP_CAMERA_QueueStart(),
+       then get the latest captured frame with BSP_CAMERA_AcquireFrame() and
+       give it back with BSP_CAMERA_ReleaseFrame() once processed. Capture
+       goes on in the other buffers meanwhile, BSP_CAMERA_FrameEventCallback()
+       being called for each new frame.
+     o Or stream frames through a small ring of N-line strips with
+       BSP_CAMERA_StripStart(), a callback processing each strip as soon as
+       it is captured.
 
   + Options
      o Increase or decrease on the fly the brightness and/or contrast
@@ -46,7 +54,7 @@
 ------------------------------------------------------------------------------*/
 
 /* Includes ------------------------------------------------------------------*/
-#include "stm32h747i_discovery_camera.h"
+#include "stm32h747i_discovery_camera_patch.h"
 
 
 /** @addtogroup BSP
@@ -81,6 +89,52 @@ uint32_t CameraRotation = CAMERA_ROTATION_INVALID;
 
 /* Camera module I2C HW address */
 static uint32_t CameraHwAddress;
+
+/* Capture frame queue buffer states */
+#define CAMERA_BUFFER_FREE      0U  /* Available for capture                  */
+#define CAMERA_BUFFER_CAPTURE   1U  /* Targeted by the DMA                    */
+#define CAMERA_BUFFER_READY     2U  /* Holds a complete frame                 */
+#define CAMERA_BUFFER_ACQUIRED  3U  /* Handed out to the application          */
+
+/* Capture frame queue. A frame is captured in NbChunks DMA transfers of at
+ * most 0xFFFF words, the DMA running in double-buffer mode: while a chunk is
+ * written through one memory target, the other one is reprogrammed with the
+ * chunk after the next. */
+static struct
+{
+  uint8_t  *pBuffer[CAMERA_QUEUE_MAX_BUFFERS];
+  uint32_t Sequence[CAMERA_QUEUE_MAX_BUFFERS];
+  uint32_t Timestamp[CAMERA_QUEUE_MAX_BUFFERS];
+  volatile uint8_t State[CAMERA_QUEUE_MAX_BUFFERS];
+  uint32_t NbBuffers;
+  uint32_t NbChunks;
+  uint32_t ChunkSize;        /* In bytes                                       */
+  uint32_t CaptureBuffer;    /* Buffer of the chunk being written              */
+  uint32_t CaptureChunk;     /* Chunk being written, in the frame              */
+  uint32_t NextBuffer;       /* Buffer of the last programmed chunk            */
+  uint32_t NextChunk;        /* Last programmed chunk, in the frame            */
+  uint32_t Acquired;         /* Frames held by the application                 */
+  uint32_t NextSequence;     /* Sequence number of the next complete frame     */
+  volatile uint32_t Dropped; /* Complete frames never handed out              */
+} CameraQueue;
+
+/* Strip capture ring. Each DMA transfer is one strip, the DMA running in
+ * double-buffer mode through the ring as for the frame queue. */
+static struct
+{
+  uint8_t  *pRing;
+  uint32_t NbStrips;
+  uint32_t StripLines;
+  uint32_t StripSize;       /* In bytes                                        */
+  uint32_t FrameStrips;     /* Strips per frame                                */
+  uint32_t CaptureStrip;    /* Ring index of the strip being written           */
+  uint32_t CaptureLine;     /* First frame line of the strip being written     */
+  uint32_t NextStrip;       /* Ring index of the last programmed strip         */
+  CAMERA_StripCallbackTypeDef Callback;
+} CameraStrip;
+
+/* DCMI overrun errors (data lost by the DCMI, its FIFO not read in time) */
+static volatile uint32_t CameraOverruns = 0U;
 /**
   * @}
   */
@@ -89,6 +143,16 @@ static uint32_t CameraHwAddress;
   * @{
   */
 static uint32_t GetSize(uint32_t Resolution);
+static uint32_t GetLines(uint32_t Resolution);
+static uint32_t CAMERA_QueueTakeBuffer(void);
+static void CAMERA_QueueXferCplt(DMA_HandleTypeDef *hdma);
+static void CAMERA_QueueXferM1Cplt(DMA_HandleTypeDef *hdma);
+static void CAMERA_QueueChunkDone(uint32_t Memory);
+static void CAMERA_XferError(DMA_HandleTypeDef *hdma);
+static uint8_t CAMERA_StartMultiBuffer(uint32_t Memory0, uint32_t Memory1, uint32_t Length);
+static void CAMERA_StripDone(uint32_t Memory);
+static void CAMERA_StripXferCplt(DMA_HandleTypeDef *hdma);
+static void CAMERA_StripXferM1Cplt(DMA_HandleTypeDef *hdma);
 /**
   * @}
   */
@@ -237,6 +301,223 @@ void BSP_CAMERA_SnapshotStart(uint8_t *buff)
   HAL_DCMI_Start_DMA(&hdcmi_discovery, DCMI_MODE_SNAPSHOT, (uint32_t)buff, GetSize(CameraCurrentResolution));
 }
 
+/**
+  * @brief  Starts the camera capture in continuous mode into a queue of frame
+  *         buffers, so that a frame can be processed while the next ones are
+  *         captured. The application may hold at most NbBuffers - 2 frames at
+  *         once.
+  * @param  pBuffers: frame buffers, each large enough for a frame, 32-byte
+  *         aligned and accessible by the DMA (not in DTCM)
+  * @param  NbBuffers: number of buffers, from 3 to CAMERA_QUEUE_MAX_BUFFERS
+  * @retval Camera status
+  */
+uint8_t BSP_CAMERA_QueueStart(uint8_t **pBuffers, uint32_t NbBuffers)
+{
+  uint32_t size = GetSize(CameraCurrentResolution);
+  uint32_t i;
+
+  if((NbBuffers < 3U) || (NbBuffers > CAMERA_QUEUE_MAX_BUFFERS) || (size == 0U))
+  {
+    return CAMERA_ERROR;
+  }
+
+  /* Split the frame in equal chunks of at most 0xFFFF words */
+  CameraQueue.NbChunks = 1U;
+  while(((size / CameraQueue.NbChunks) > 0xFFFFU) || ((size % CameraQueue.NbChunks) != 0U))
+  {
+    CameraQueue.NbChunks++;
+  }
+  CameraQueue.ChunkSize = (size / CameraQueue.NbChunks) * 4U;
+
+  for(i = 0; i < NbBuffers; i++)
+  {
+    CameraQueue.pBuffer[i] = pBuffers[i];
+    CameraQueue.State[i] = CAMERA_BUFFER_FREE;
+  }
+  CameraQueue.NbBuffers = NbBuffers;
+  CameraQueue.Acquired = 0U;
+  CameraQueue.NextSequence = 0U;
+  CameraQueue.Dropped = 0U;
+
+  /* First two chunks: memory 0 and memory 1 targets */
+  CameraQueue.CaptureBuffer = 0U;
+  CameraQueue.CaptureChunk = 0U;
+  CameraQueue.State[0] = CAMERA_BUFFER_CAPTURE;
+  if(CameraQueue.NbChunks > 1U)
+  {
+    CameraQueue.NextBuffer = 0U;
+    CameraQueue.NextChunk = 1U;
+  }
+  else
+  {
+    CameraQueue.NextBuffer = 1U;
+    CameraQueue.NextChunk = 0U;
+    CameraQueue.State[1] = CAMERA_BUFFER_CAPTURE;
+  }
+
+  hdcmi_discovery.DMA_Handle->XferCpltCallback = CAMERA_QueueXferCplt;
+  hdcmi_discovery.DMA_Handle->XferM1CpltCallback = CAMERA_QueueXferM1Cplt;
+
+  return CAMERA_StartMultiBuffer((uint32_t)CameraQueue.pBuffer[0],
+                                 (uint32_t)(CameraQueue.pBuffer[CameraQueue.NextBuffer] +
+                                            CameraQueue.NextChunk * CameraQueue.ChunkSize),
+                                 CameraQueue.ChunkSize / 4U);
+}
+
+/**
+  * @brief  Starts the camera capture in continuous mode into a ring of strips
+  *         of StripLines lines. Callback is called from the DMA interrupt as
+  *         soon as a strip is captured (its cache lines being invalidated)
+  *         and must return before the next strip is complete, the DMA
+  *         otherwise overwriting strips not processed yet.
+  *         BSP_CAMERA_FrameEventCallback() is called after the last strip of
+  *         each frame.
+  * @param  pRing: strips memory, NbStrips * StripLines lines, 32-byte aligned
+  *         and accessible by the DMA (AXI or D2 SRAM, not DTCM)
+  * @param  NbStrips: number of strips in the ring, at least 2
+  * @param  StripLines: lines per strip, dividing the frame height
+  * @param  Callback: strip callback
+  * @retval Camera status
+  */
+uint8_t BSP_CAMERA_StripStart(uint8_t *pRing, uint32_t NbStrips, uint32_t StripLines,
+                              CAMERA_StripCallbackTypeDef Callback)
+{
+  uint32_t lines = GetLines(CameraCurrentResolution);
+  uint32_t line_size;
+
+  if((NbStrips < 2U) || (StripLines == 0U) || (lines == 0U) ||
+     ((lines % StripLines) != 0U) || (Callback == NULL))
+  {
+    return CAMERA_ERROR;
+  }
+
+  line_size = (GetSize(CameraCurrentResolution) / lines) * 4U;
+  if(((line_size * StripLines) / 4U) > 0xFFFFU)
+  {
+    return CAMERA_ERROR;
+  }
+
+  CameraStrip.pRing = pRing;
+  CameraStrip.NbStrips = NbStrips;
+  CameraStrip.StripLines = StripLines;
+  CameraStrip.StripSize = line_size * StripLines;
+  CameraStrip.FrameStrips = lines / StripLines;
+  CameraStrip.CaptureStrip = 0U;
+  CameraStrip.CaptureLine = 0U;
+  CameraStrip.NextStrip = 1U;
+  CameraStrip.Callback = Callback;
+
+  hdcmi_discovery.DMA_Handle->XferCpltCallback = CAMERA_StripXferCplt;
+  hdcmi_discovery.DMA_Handle->XferM1CpltCallback = CAMERA_StripXferM1Cplt;
+
+  return CAMERA_StartMultiBuffer((uint32_t)pRing, (uint32_t)(pRing + CameraStrip.StripSize),
+                                 CameraStrip.StripSize / 4U);
+}
+
+/**
+  * @brief  Hands out the latest captured frame. Older complete frames are
+  *         discarded (and counted as dropped). The frame data cache lines are
+  *         invalidated.
+  * @param  Frame: captured frame, to be given back with BSP_CAMERA_ReleaseFrame()
+  * @retval CAMERA_OK, or CAMERA_ERROR if no new frame is available or too many
+  *         frames are held
+  */
+uint8_t BSP_CAMERA_AcquireFrame(CAMERA_FrameTypeDef *Frame)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t latest = CAMERA_QUEUE_MAX_BUFFERS;
+  uint32_t i;
+
+  __disable_irq();
+
+  if(CameraQueue.Acquired + 2U < CameraQueue.NbBuffers)
+  {
+    for(i = 0; i < CameraQueue.NbBuffers; i++)
+    {
+      if(CameraQueue.State[i] == CAMERA_BUFFER_READY)
+      {
+        if(latest == CAMERA_QUEUE_MAX_BUFFERS)
+        {
+          latest = i;
+        }
+        else if((int32_t)(CameraQueue.Sequence[i] - CameraQueue.Sequence[latest]) > 0)
+        {
+          CameraQueue.State[latest] = CAMERA_BUFFER_FREE;
+          CameraQueue.Dropped++;
+          latest = i;
+        }
+        else
+        {
+          CameraQueue.State[i] = CAMERA_BUFFER_FREE;
+          CameraQueue.Dropped++;
+        }
+      }
+    }
+    if(latest != CAMERA_QUEUE_MAX_BUFFERS)
+    {
+      CameraQueue.State[latest] = CAMERA_BUFFER_ACQUIRED;
+      CameraQueue.Acquired++;
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  if(latest == CAMERA_QUEUE_MAX_BUFFERS)
+  {
+    return CAMERA_ERROR;
+  }
+
+  Frame->pData = CameraQueue.pBuffer[latest];
+  Frame->Sequence = CameraQueue.Sequence[latest];
+  Frame->Timestamp = CameraQueue.Timestamp[latest];
+  Frame->Index = latest;
+
+  /* The DMA wrote behind the data cache */
+  SCB_InvalidateDCache_by_Addr((uint32_t *)Frame->pData,
+                               (int32_t)(CameraQueue.NbChunks * CameraQueue.ChunkSize));
+
+  return CAMERA_OK;
+}
+
+/**
+  * @brief  Gives back a frame obtained with BSP_CAMERA_AcquireFrame(), its
+  *         buffer becoming available for capture.
+  * @param  Frame: frame to release
+  * @retval None
+  */
+void BSP_CAMERA_ReleaseFrame(CAMERA_FrameTypeDef *Frame)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if(CameraQueue.State[Frame->Index] == CAMERA_BUFFER_ACQUIRED)
+  {
+    CameraQueue.State[Frame->Index] = CAMERA_BUFFER_FREE;
+    CameraQueue.Acquired--;
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Get the number of complete frames never handed out to the
+  *         application since BSP_CAMERA_QueueStart().
+  * @retval Dropped frames count
+  */
+uint32_t BSP_CAMERA_GetDroppedFrames(void)
+{
+  return CameraQueue.Dropped;
+}
+
+/**
+  * @brief  Get the number of DCMI overrun errors since the startup, each one
+  *         also reported by BSP_CAMERA_ErrorCallback().
+  * @retval Overrun errors count
+  */
+uint32_t BSP_CAMERA_GetOverruns(void)
+{
+  return CameraOverruns;
+}
+
 /**
   * @brief Suspend the CAMERA capture 
   * @retval None
@@ -425,6 +706,234 @@ static uint32_t GetSize(uint32_t Resolution)
   return size;
 }
 
+/**
+  * @brief  Picks the buffer of the next frame to capture: a free one, else the
+  *         oldest complete frame, which is dropped. One of them always exists
+  *         as the application holds at most NbBuffers - 2 frames.
+  * @retval Buffer index
+  */
+static uint32_t CAMERA_QueueTakeBuffer(void)
+{
+  uint32_t oldest = CAMERA_QUEUE_MAX_BUFFERS;
+  uint32_t i;
+
+  for(i = 0; i < CameraQueue.NbBuffers; i++)
+  {
+    if(CameraQueue.State[i] == CAMERA_BUFFER_FREE)
+    {
+      CameraQueue.State[i] = CAMERA_BUFFER_CAPTURE;
+      return i;
+    }
+    if((CameraQueue.State[i] == CAMERA_BUFFER_READY) &&
+       ((oldest == CAMERA_QUEUE_MAX_BUFFERS) ||
+        ((int32_t)(CameraQueue.Sequence[i] - CameraQueue.Sequence[oldest]) < 0)))
+    {
+      oldest = i;
+    }
+  }
+
+  CameraQueue.Dropped++;
+  CameraQueue.State[oldest] = CAMERA_BUFFER_CAPTURE;
+  return oldest;
+}
+
+/**
+  * @brief  Handles the end of a chunk transfer: publishes the frame when it was
+  *         the last chunk, then reprograms the memory target it used with the
+  *         chunk after the next.
+  * @param  Memory: memory target of the completed chunk
+  * @retval None
+  */
+static void CAMERA_QueueChunkDone(uint32_t Memory)
+{
+  DMA_HandleTypeDef *hdma = hdcmi_discovery.DMA_Handle;
+
+  if(++CameraQueue.CaptureChunk == CameraQueue.NbChunks)
+  {
+    CameraQueue.Timestamp[CameraQueue.CaptureBuffer] = CAMERA_TIMESTAMP();
+    CameraQueue.Sequence[CameraQueue.CaptureBuffer] = CameraQueue.NextSequence++;
+    CameraQueue.State[CameraQueue.CaptureBuffer] = CAMERA_BUFFER_READY;
+
+    /* Capture goes on in the last programmed chunk, first of its frame */
+    CameraQueue.CaptureBuffer = CameraQueue.NextBuffer;
+    CameraQueue.CaptureChunk = 0U;
+
+    BSP_CAMERA_FrameEventCallback();
+  }
+
+  if(++CameraQueue.NextChunk == CameraQueue.NbChunks)
+  {
+    CameraQueue.NextChunk = 0U;
+    CameraQueue.NextBuffer = CAMERA_QueueTakeBuffer();
+  }
+
+  HAL_DMAEx_ChangeMemory(hdma, (uint32_t)(CameraQueue.pBuffer[CameraQueue.NextBuffer] +
+                                          CameraQueue.NextChunk * CameraQueue.ChunkSize),
+                         (Memory == 0U) ? MEMORY0 : MEMORY1);
+}
+
+/**
+  * @brief  Starts the DCMI continuous capture with the DMA in double-buffer
+  *         mode, as HAL_DCMI_Start_DMA() does for large frames but leaving the
+  *         transfer complete callbacks set by the caller in place.
+  * @param  Memory0: memory 0 target address
+  * @param  Memory1: memory 1 target address
+  * @param  Length: transfer length in words
+  * @retval Camera status
+  */
+static uint8_t CAMERA_StartMultiBuffer(uint32_t Memory0, uint32_t Memory1, uint32_t Length)
+{
+  DCMI_HandleTypeDef *phdcmi = &hdcmi_discovery;
+
+  __HAL_LOCK(phdcmi);
+  phdcmi->State = HAL_DCMI_STATE_BUSY;
+  __HAL_DCMI_ENABLE(phdcmi);
+  phdcmi->Instance->CR &= ~(DCMI_CR_CM);
+  phdcmi->Instance->CR |= DCMI_MODE_CONTINUOUS;
+
+  phdcmi->DMA_Handle->XferErrorCallback = CAMERA_XferError;
+  phdcmi->DMA_Handle->XferAbortCallback = NULL;
+
+  if(HAL_DMAEx_MultiBufferStart_IT(phdcmi->DMA_Handle, (uint32_t)&phdcmi->Instance->DR,
+                                   Memory0, Memory1, Length) != HAL_OK)
+  {
+    phdcmi->ErrorCode = HAL_DCMI_ERROR_DMA;
+    phdcmi->State = HAL_DCMI_STATE_READY;
+    __HAL_UNLOCK(phdcmi);
+    return CAMERA_ERROR;
+  }
+
+  phdcmi->Instance->CR |= DCMI_CR_CAPTURE;
+  __HAL_UNLOCK(phdcmi);
+
+  return CAMERA_OK;
+}
+
+/**
+  * @brief  Handles the end of a strip transfer: reprograms the memory target it
+  *         used with the strip after the next, then hands the strip out.
+  * @param  Memory: memory target of the completed strip
+  * @retval None
+  */
+static void CAMERA_StripDone(uint32_t Memory)
+{
+  uint8_t *pStrip = CameraStrip.pRing + CameraStrip.CaptureStrip * CameraStrip.StripSize;
+  uint32_t line = CameraStrip.CaptureLine;
+
+  if(++CameraStrip.NextStrip == CameraStrip.NbStrips)
+  {
+    CameraStrip.NextStrip = 0U;
+  }
+  HAL_DMAEx_ChangeMemory(hdcmi_discovery.DMA_Handle,
+                         (uint32_t)(CameraStrip.pRing + CameraStrip.NextStrip * CameraStrip.StripSize),
+                         (Memory == 0U) ? MEMORY0 : MEMORY1);
+
+  if(++CameraStrip.CaptureStrip == CameraStrip.NbStrips)
+  {
+    CameraStrip.CaptureStrip = 0U;
+  }
+  CameraStrip.CaptureLine += CameraStrip.StripLines;
+  if(CameraStrip.CaptureLine == CameraStrip.FrameStrips * CameraStrip.StripLines)
+  {
+    CameraStrip.CaptureLine = 0U;
+  }
+
+  /* The DMA wrote behind the data cache */
+  SCB_InvalidateDCache_by_Addr((uint32_t *)pStrip, (int32_t)CameraStrip.StripSize);
+  CameraStrip.Callback(pStrip, line, CameraStrip.StripLines);
+
+  if(CameraStrip.CaptureLine == 0U)
+  {
+    BSP_CAMERA_FrameEventCallback();
+  }
+}
+
+/**
+  * @brief  DMA memory 0 transfer complete callback (strip ring)
+  * @param  hdma: pointer to the DMA handle
+  * @retval None
+  */
+static void CAMERA_StripXferCplt(DMA_HandleTypeDef *hdma)
+{
+  CAMERA_StripDone(0U);
+}
+
+/**
+  * @brief  DMA memory 1 transfer complete callback (strip ring)
+  * @param  hdma: pointer to the DMA handle
+  * @retval None
+  */
+static void CAMERA_StripXferM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  CAMERA_StripDone(1U);
+}
+
+/**
+  * @brief  DMA memory 0 transfer complete callback (frame queue)
+  * @param  hdma: pointer to the DMA handle
+  * @retval None
+  */
+static void CAMERA_QueueXferCplt(DMA_HandleTypeDef *hdma)
+{
+  CAMERA_QueueChunkDone(0U);
+}
+
+/**
+  * @brief  DMA memory 1 transfer complete callback (frame queue)
+  * @param  hdma: pointer to the DMA handle
+  * @retval None
+  */
+static void CAMERA_QueueXferM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  CAMERA_QueueChunkDone(1U);
+}
+
+/**
+  * @brief  DMA error callback (frame queue and strip ring), FIFO errors being
+  *         ignored as in the DCMI driver.
+  * @param  hdma: pointer to the DMA handle
+  * @retval None
+  */
+static void CAMERA_XferError(DMA_HandleTypeDef *hdma)
+{
+  if(hdma->ErrorCode != HAL_DMA_ERROR_FE)
+  {
+    hdcmi_discovery.State = HAL_DCMI_STATE_READY;
+    hdcmi_discovery.ErrorCode |= HAL_DCMI_ERROR_DMA;
+    HAL_DCMI_ErrorCallback(&hdcmi_discovery);
+  }
+}
+
+/**
+  * @brief  Get the capture height in lines.
+  * @param  Resolution: the current resolution.
+  * @retval capture height in lines.
+  */
+static uint32_t GetLines(uint32_t Resolution)
+{
+  uint32_t lines = 0;
+
+  switch (Resolution)
+  {
+  case CAMERA_R160x120:
+    lines = CAMERA_QQVGA_RES_Y;
+    break;
+  case CAMERA_R320x240:
+    lines = CAMERA_QVGA_RES_Y;
+    break;
+  case CAMERA_R480x272:
+    lines = CAMERA_480x272_RES_Y;
+    break;
+  case CAMERA_R640x480:
+    lines = CAMERA_VGA_RES_Y;
+    break;
+  default:
+    break;
+  }
+
+  return lines;
+}
+
 /**
   * @brief  Initializes the DCMI MSP.
   * @param  hdcmi: HDMI handle
@@ -614,6 +1123,11 @@ __weak void BSP_CAMERA_FrameEventCallback(void)
   */
 void HAL_DCMI_ErrorCallback(DCMI_HandleTypeDef *hdcmi)
 {        
+  if((hdcmi->ErrorCode & HAL_DCMI_ERROR_OVR) != 0U)
+  {
+    hdcmi->ErrorCode &= ~HAL_DCMI_ERROR_OVR;
+    CameraOverruns++;
+  }
   BSP_CAMERA_ErrorCallback();
 }
 
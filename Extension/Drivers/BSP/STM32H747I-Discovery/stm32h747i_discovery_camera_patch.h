@@ -0,0 +1,114 @@
+/**
+  ******************************************************************************
+  * @file    stm32h747i_discovery_camera_patch.h
+  * @brief   This file contains the defines and functions prototypes added to
+  *          the stm32h747i_discovery_camera.c driver by its patched version.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32H747I_DISCOVERY_CAMERA_PATCH_H
+#define __STM32H747I_DISCOVERY_CAMERA_PATCH_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h747i_discovery_camera.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup STM32H747I_DISCOVERY
+  * @{
+  */
+
+/** @addtogroup STM32H747I_DISCOVERY_CAMERA
+  * @{
+  */
+
+/** @defgroup STM32H747I_DISCOVERY_CAMERA_Queue_Exported_Constants Frame Queue Exported Constants
+  * @{
+  */
+/** @brief Maximum number of buffers of the capture frame queue
+  */
+#define CAMERA_QUEUE_MAX_BUFFERS  4
+
+/** @brief Frame timestamp source, in HAL ticks (ms) unless overridden
+  */
+#ifndef CAMERA_TIMESTAMP
+#define CAMERA_TIMESTAMP()  HAL_GetTick()
+#endif
+/**
+  * @}
+  */
+
+/** @defgroup STM32H747I_DISCOVERY_CAMERA_Queue_Exported_Types Frame Queue and Strip Exported Types
+  * @{
+  */
+/**
+  * @brief  Captured frame, handed out by BSP_CAMERA_AcquireFrame()
+  */
+typedef struct
+{
+  uint8_t  *pData;     /*!< Frame data                                        */
+  uint32_t Sequence;   /*!< Capture sequence number, gaps are dropped frames  */
+  uint32_t Timestamp;  /*!< End of capture time (CAMERA_TIMESTAMP())          */
+  uint32_t Index;      /*!< Buffer index in the queue (private)               */
+} CAMERA_FrameTypeDef;
+
+/**
+  * @brief  Strip callback: NbLines lines of the frame, from line Line, are
+  *         available at pStrip
+  */
+typedef void (*CAMERA_StripCallbackTypeDef)(uint8_t *pStrip, uint32_t Line, uint32_t NbLines);
+/**
+  * @}
+  */
+
+/** @addtogroup STM32H747I_DISCOVERY_CAMERA_Exported_Functions
+  * @{
+  */
+uint8_t  BSP_CAMERA_QueueStart(uint8_t **pBuffers, uint32_t NbBuffers);
+uint8_t  BSP_CAMERA_AcquireFrame(CAMERA_FrameTypeDef *Frame);
+void     BSP_CAMERA_ReleaseFrame(CAMERA_FrameTypeDef *Frame);
+uint32_t BSP_CAMERA_GetDroppedFrames(void);
+uint32_t BSP_CAMERA_GetOverruns(void);
+uint8_t  BSP_CAMERA_StripStart(uint8_t *pRing, uint32_t NbStrips, uint32_t StripLines,
+                               CAMERA_StripCallbackTypeDef Callback);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32H747I_DISCOVERY_CAMERA_PATCH_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
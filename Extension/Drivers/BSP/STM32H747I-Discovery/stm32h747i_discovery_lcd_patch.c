@@ -212,6 +212,14 @@ static uint32_t  ActiveLayer = LTDC_ACTIVE_LAYER_BACKGROUND;
   * @brief  Current Drawing Layer properties variable
   */
 static LCD_DrawPropTypeDef DrawProp[LTDC_MAX_LAYER_NUMBER];
+
+/**
+  * @brief  A8 glyph atlas of the last used font, and A8 coverage of the string
+  *         being drawn (read by the DMA2D)
+  */
+static uint8_t GlyphAtlas[LCD_GLYPH_COUNT * LCD_GLYPH_MAX_WIDTH * LCD_GLYPH_MAX_HEIGHT];
+static sFONT *GlyphAtlasFont = NULL;
+ALIGN_32BYTES(static uint8_t TextRun[OTM8009A_800X480_WIDTH * LCD_GLYPH_MAX_HEIGHT]);
 /**
   * @}
   */
@@ -220,9 +228,13 @@ static LCD_DrawPropTypeDef DrawProp[LTDC_MAX_LAYER_NUMBER];
   * @{
   */
 static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c);
+static void DrawString(uint16_t Xpos, uint16_t Ypos, const uint8_t *Text, uint32_t Count);
+static void BuildGlyphAtlas(sFONT *fonts);
 static void FillTriangle(uint16_t x1, uint16_t x2, uint16_t x3, uint16_t y1, uint16_t y2, uint16_t y3);
 static void LL_FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex);
 static void LL_ConvertLineToARGB8888(void * pSrc, void *pDst, uint32_t xSize, uint32_t ColorMode);
+static void LL_BlendA8(void *pSrc, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t Color);
+static void LL_CleanInvalidateArea(void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine);
 static uint16_t LCD_IO_GetID(void);
 /**
   * @}
@@ -999,8 +1011,7 @@ void BSP_LCD_ClearStringLine(uint32_t Line)
   */
 void BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii)
 {
-  DrawChar(Xpos, Ypos, &DrawProp[ActiveLayer].pFont->table[(Ascii-' ') *\
-    DrawProp[ActiveLayer].pFont->Height * ((DrawProp[ActiveLayer].pFont->Width + 7) / 8)]);
+  DrawString(Xpos, Ypos, &Ascii, 1);
 }
 
 /**
@@ -1057,19 +1068,18 @@ void BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_A
     refcolumn = 1;
   }
 
-  /* Send the string character by character on LCD */
-  while ((*Text != 0) & (((BSP_LCD_GetXSize() - (i*DrawProp[ActiveLayer].pFont->Width)) & 0xFFFF) >= DrawProp[ActiveLayer].pFont->Width))
+  /* Count the characters fitting in the screen */
+  while ((Text[i] != 0) & (((BSP_LCD_GetXSize() - (i*DrawProp[ActiveLayer].pFont->Width)) & 0xFFFF) >= DrawProp[ActiveLayer].pFont->Width))
   {
-    /* Display one character on LCD */
-    BSP_LCD_DisplayChar(refcolumn, Ypos, *Text);
-    /* Decrement the column position by 16 */
-    refcolumn += DrawProp[ActiveLayer].pFont->Width;
-
-    /* Point on the next character */
-    Text++;
     i++;
   }
 
+  if(i != 0)
+  {
+    /* Send the whole string at once on LCD */
+    DrawString(refcolumn, Ypos, Text, i);
+  }
+
 }
 
 /**
@@ -1379,6 +1389,8 @@ void BSP_LCD_DrawBitmap(uint32_t Xpos, uint32_t Ypos, uint8_t *pbmp)
     Address+=  (BSP_LCD_GetXSize()*4);
     pbmp -= width*(bit_pixel/8);
   }
+
+  BSP_LCD_DamageCallback(ActiveLayer, Xpos, Ypos, width, height);
 }
 
 /**
@@ -1680,6 +1692,38 @@ static uint16_t LCD_IO_GetID(void)
 /*******************************************************************************
                        LTDC, DMA2D and DSI BSP Routines
 *******************************************************************************/
+/**
+  * @brief  Waits until the DMA2D can be programmed by the BSP drawing routines.
+  *         Application sharing the DMA2D (e.g. with an interrupt-driven job
+  *         queue) must surcharge this function to wait for its own transfers.
+  * @retval None
+  */
+__weak void BSP_LCD_DMA2D_WaitIdle(void)
+{
+}
+
+/**
+  * @brief  Reports an area of a layer modified by the BSP drawing routines:
+  *         every DMA2D fill, pixel write and bitmap.
+  *         Application tracking damaged areas (e.g. for partial frame buffer
+  *         updates) must surcharge this function.
+  * @param  LayerIndex: Layer index
+  * @param  Xpos: X position
+  * @param  Ypos: Y position
+  * @param  Width: Area width
+  * @param  Height: Area height
+  * @retval None
+  */
+__weak void BSP_LCD_DamageCallback(uint32_t LayerIndex, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(LayerIndex);
+  UNUSED(Xpos);
+  UNUSED(Ypos);
+  UNUSED(Width);
+  UNUSED(Height);
+}
+
 /**
   * @brief  De-Initializes the BSP LCD Msp
   *         Application can surcharge if needed this function implementation.
@@ -1759,6 +1803,8 @@ void BSP_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code)
 {
   /* Write data value to all SDRAM memory */
   *(__IO uint32_t*) (hltdc_discovery.LayerCfg[ActiveLayer].FBStartAdress + (4*(Ypos*BSP_LCD_GetXSize() + Xpos))) = RGB_Code;
+
+  BSP_LCD_DamageCallback(ActiveLayer, Xpos, Ypos, 1, 1);
 }
 /**
   * @}
@@ -1824,6 +1870,119 @@ static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
   }
 }
 
+/**
+  * @brief  Draws characters on LCD from the glyph atlas: their coverage is
+  *         assembled in an A8 buffer, then drawn with two DMA2D transfers
+  *         (background color fill and text color blending).
+  * @param  Xpos: Start column address
+  * @param  Ypos: Line where to display the characters
+  * @param  Text: Pointer to the characters
+  * @param  Count: Number of characters
+  * @retval None
+  */
+static void DrawString(uint16_t Xpos, uint16_t Ypos, const uint8_t *Text, uint32_t Count)
+{
+  sFONT *fonts = DrawProp[ActiveLayer].pFont;
+  uint32_t width = Count * fonts->Width;
+  uint32_t glyph_size = fonts->Width * fonts->Height;
+  uint32_t i = 0, j = 0, k = 0;
+  uint8_t  ascii;
+  uint32_t Xaddress;
+
+  if((fonts->Width > LCD_GLYPH_MAX_WIDTH) || (fonts->Height > LCD_GLYPH_MAX_HEIGHT) || (width > OTM8009A_800X480_WIDTH))
+  {
+    /* Glyphs out of the atlas: draw character by character */
+    for(i = 0; i < Count; i++)
+    {
+      DrawChar(Xpos + i * fonts->Width, Ypos, &fonts->table[(Text[i]-' ') * fonts->Height * ((fonts->Width + 7) / 8)]);
+    }
+    return;
+  }
+
+  BuildGlyphAtlas(fonts);
+
+  /* Assemble the string coverage, line by line */
+  for(i = 0; i < fonts->Height; i++)
+  {
+    uint8_t *pRun = &TextRun[i * width];
+
+    for(j = 0; j < Count; j++)
+    {
+      ascii = ((Text[j] < ' ') || (Text[j] > '~')) ? ' ' : Text[j];
+      const uint8_t *pGlyph = &GlyphAtlas[(ascii - ' ') * glyph_size + i * fonts->Width];
+
+      for(k = 0; k < fonts->Width; k++)
+      {
+        *pRun++ = pGlyph[k];
+      }
+    }
+  }
+  SCB_CleanDCache_by_Addr((uint32_t *)TextRun, (int32_t)(width * fonts->Height));
+
+  Xaddress = (hltdc_discovery.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
+
+  LL_FillBuffer(ActiveLayer, (uint32_t *)Xaddress, width, fonts->Height, (BSP_LCD_GetXSize() - width), DrawProp[ActiveLayer].BackColor);
+  LL_BlendA8(TextRun, (uint32_t *)Xaddress, width, fonts->Height, (BSP_LCD_GetXSize() - width), DrawProp[ActiveLayer].TextColor);
+}
+
+/**
+  * @brief  Expands a font to the A8 glyph atlas (0x00 or 0xFF per pixel),
+  *         unless it is already there.
+  * @param  fonts: Font, at most LCD_GLYPH_MAX_WIDTH x LCD_GLYPH_MAX_HEIGHT
+  * @retval None
+  */
+static void BuildGlyphAtlas(sFONT *fonts)
+{
+  uint32_t c = 0, i = 0, j = 0;
+  uint16_t height, width;
+  uint8_t  offset;
+  const uint8_t *pchar;
+  uint8_t  *pglyph = GlyphAtlas;
+  uint32_t line;
+
+  if(GlyphAtlasFont == fonts)
+  {
+    return;
+  }
+
+  height = fonts->Height;
+  width  = fonts->Width;
+
+  offset =  8 *((width + 7)/8) -  width ;
+
+  for(c = 0; c < LCD_GLYPH_COUNT; c++)
+  {
+    for(i = 0; i < height; i++)
+    {
+      pchar = &fonts->table[(c * height + i) * ((width + 7) / 8)];
+
+      switch(((width + 7)/8))
+      {
+
+      case 1:
+        line =  pchar[0];
+        break;
+
+      case 2:
+        line =  (pchar[0]<< 8) | pchar[1];
+        break;
+
+      case 3:
+      default:
+        line =  (pchar[0]<< 16) | (pchar[1]<< 8) | pchar[2];
+        break;
+      }
+
+      for (j = 0; j < width; j++)
+      {
+        *pglyph++ = (line & (1 << (width- j + offset- 1))) ? 0xFF : 0x00;
+      }
+    }
+  }
+
+  GlyphAtlasFont = fonts;
+}
+
 /**
   * @brief  Fills a triangle (between 3 points).
   * @param  x1: Point 1 X position
@@ -1914,6 +2073,14 @@ static void FillTriangle(uint16_t x1, uint16_t x2, uint16_t x3, uint16_t y1, uin
   */
 static void LL_FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex)
 {
+  uint32_t offset;
+
+  /* DMA2D may be shared with other users */
+  BSP_LCD_DMA2D_WaitIdle();
+
+  /* No dirty cache line may overwrite the DMA2D output afterwards */
+  LL_CleanInvalidateArea(pDst, xSize, ySize, OffLine);
+
   /* Register to memory mode with ARGB8888 as color Mode */
   hdma2d_discovery.Init.Mode         = DMA2D_R2M;
   hdma2d_discovery.Init.ColorMode    = DMA2D_OUTPUT_ARGB8888;
@@ -1933,6 +2100,92 @@ static void LL_FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint3
       }
     }
   }
+
+  /* Report the area, found back from its address in the layer */
+  offset = ((uint32_t)pDst - hltdc_discovery.LayerCfg[LayerIndex].FBStartAdress) / 4;
+  BSP_LCD_DamageCallback(LayerIndex, offset % BSP_LCD_GetXSize(), offset / BSP_LCD_GetXSize(), xSize, ySize);
+}
+
+/**
+  * @brief  Blends an A8 buffer of a color over an ARGB8888 area, in place.
+  * @param  pSrc: Pointer to the A8 source buffer
+  * @param  pDst: Pointer to destination area
+  * @param  xSize: Area width
+  * @param  ySize: Area height
+  * @param  OffLine: Offset
+  * @param  Color: ARGB8888 color
+  * @retval None
+  */
+static void LL_BlendA8(void *pSrc, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t Color)
+{
+  /* DMA2D may be shared with other users */
+  BSP_LCD_DMA2D_WaitIdle();
+
+  /* Memory to memory with blending mode with ARGB8888 as output color Mode */
+  hdma2d_discovery.Init.Mode         = DMA2D_M2M_BLEND;
+  hdma2d_discovery.Init.ColorMode    = DMA2D_OUTPUT_ARGB8888;
+  hdma2d_discovery.Init.OutputOffset = OffLine;
+
+  /* Foreground Configuration: the color, its alpha multiplied by the coverage */
+  hdma2d_discovery.LayerCfg[1].AlphaMode = DMA2D_COMBINE_ALPHA;
+  hdma2d_discovery.LayerCfg[1].InputAlpha = Color;
+  hdma2d_discovery.LayerCfg[1].InputColorMode = DMA2D_INPUT_A8;
+  hdma2d_discovery.LayerCfg[1].InputOffset = 0;
+  hdma2d_discovery.LayerCfg[1].AlphaInverted = DMA2D_REGULAR_ALPHA;
+  hdma2d_discovery.LayerCfg[1].RedBlueSwap = DMA2D_RB_REGULAR;
+
+  /* Background Configuration: the destination area */
+  hdma2d_discovery.LayerCfg[0].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+  hdma2d_discovery.LayerCfg[0].InputAlpha = 0xFF;
+  hdma2d_discovery.LayerCfg[0].InputColorMode = DMA2D_INPUT_ARGB8888;
+  hdma2d_discovery.LayerCfg[0].InputOffset = OffLine;
+  hdma2d_discovery.LayerCfg[0].AlphaInverted = DMA2D_REGULAR_ALPHA;
+  hdma2d_discovery.LayerCfg[0].RedBlueSwap = DMA2D_RB_REGULAR;
+
+  hdma2d_discovery.Instance = DMA2D;
+
+  /* DMA2D Initialization */
+  if(HAL_DMA2D_Init(&hdma2d_discovery) == HAL_OK)
+  {
+    if((HAL_DMA2D_ConfigLayer(&hdma2d_discovery, 0) == HAL_OK) && (HAL_DMA2D_ConfigLayer(&hdma2d_discovery, 1) == HAL_OK))
+    {
+      if (HAL_DMA2D_BlendingStart(&hdma2d_discovery, (uint32_t)pSrc, (uint32_t)pDst, (uint32_t)pDst, xSize, ySize) == HAL_OK)
+      {
+        /* Polling For DMA transfer */
+        HAL_DMA2D_PollForTransfer(&hdma2d_discovery, 25);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Cleans and invalidates an ARGB8888 area in L1 D-Cache, line by line.
+  * @param  pDst: Pointer to the area
+  * @param  xSize: Area width
+  * @param  ySize: Area height
+  * @param  OffLine: Offset
+  * @retval None
+  */
+static void LL_CleanInvalidateArea(void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine)
+{
+  uint32_t address = (uint32_t)pDst;
+  uint32_t aligned;
+  uint32_t i = 0;
+
+  if(OffLine == 0)
+  {
+    /* Contiguous area */
+    xSize *= ySize;
+    ySize = 1;
+  }
+
+  for(i = 0; i < ySize; i++)
+  {
+    /* Maintenance by address operates on whole 32-byte cache lines */
+    aligned = address & ~31U;
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)aligned, (int32_t)(address + 4*xSize - aligned));
+    address += 4*(xSize + OffLine);
+  }
 }
 
 /**
@@ -1945,6 +2198,9 @@ static void LL_FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint3
   */
 static void LL_ConvertLineToARGB8888(void *pSrc, void *pDst, uint32_t xSize, uint32_t ColorMode)
 {
+  /* DMA2D may be shared with other users */
+  BSP_LCD_DMA2D_WaitIdle();
+
   /* Configure the DMA2D Mode, Color Mode and output offset */
   hdma2d_discovery.Init.Mode         = DMA2D_M2M_PFC;
   hdma2d_discovery.Init.ColorMode    = DMA2D_OUTPUT_ARGB8888;
@@ -92,6 +92,20 @@
  */
 #define LTDC_DEFAULT_ACTIVE_LAYER         LTDC_ACTIVE_LAYER_FOREGROUND
 
+/** @brief Largest font glyph held by the A8 glyph atlas (Font24), larger fonts
+  *        are drawn pixel by pixel
+  */
+#ifndef LCD_GLYPH_MAX_WIDTH
+#define LCD_GLYPH_MAX_WIDTH               17U
+#endif
+#ifndef LCD_GLYPH_MAX_HEIGHT
+#define LCD_GLYPH_MAX_HEIGHT              24U
+#endif
+
+/** @brief Number of glyphs of the fonts (ASCII 0x20 to 0x7E)
+  */
+#define LCD_GLYPH_COUNT                   95U
+
 /** 
   * @brief  LCD status structure definition  
   */     
@@ -313,6 +327,8 @@ uint8_t  BSP_LCD_HDMIInitEx(uint8_t format);
 
 void     BSP_LCD_MspDeInit(void);
 void     BSP_LCD_MspInit(void);
+void     BSP_LCD_DMA2D_WaitIdle(void);
+void     BSP_LCD_DamageCallback(uint32_t LayerIndex, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 void     BSP_LCD_Reset(void);
 
 uint32_t BSP_LCD_GetXSize(void);
@@ -374,6 +390,9 @@ void     BSP_LCD_SetBrightness(uint8_t BrightnessValue);
 /* @brief DMA2D handle variable */
 extern DMA2D_HandleTypeDef hdma2d_discovery;
 
+/* @brief LTDC handle variable */
+extern LTDC_HandleTypeDef hltdc_discovery;
+
 /**
   * @}
   */
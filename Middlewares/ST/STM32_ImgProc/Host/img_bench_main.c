@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * @file           : img_bench_main.c
+ * @brief          : Host entry point of the image processing micro-benchmarks
+ *                   (make host-bench), timed with the monotonic clock.
+ ******************************************************************************/
+
+#include "stm32_img_bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief  Nothing to start, the monotonic clock always runs.
+ * @retval None
+ */
+void ImgBenchTimerInit(void)
+{
+}
+
+/**
+ * @brief  Returns the monotonic clock, in nanoseconds. The 32-bit count wraps
+ *         around every 4.2 s, longer than any single case.
+ * @retval Nanoseconds, wrapping around
+ */
+uint32_t ImgBenchCycles(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t) ((uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec);
+}
+
+/**
+ * @brief  Returns the counter frequency: one "cycle" per nanosecond.
+ * @retval 1 GHz
+ */
+uint32_t ImgBenchCyclesHz(void)
+{
+  return 1000000000u;
+}
+
+int main(void)
+{
+  void *pBuffer = aligned_alloc(32, (IMG_BENCH_BUFFER_SIZE + 31) & ~31u);
+
+  if (pBuffer == NULL)
+  {
+    fprintf(stderr, "img_bench: out of memory\n");
+    return 1;
+  }
+
+  ImgBenchRun(pBuffer, IMG_BENCH_BUFFER_SIZE);
+  free(pBuffer);
+  return 0;
+}
@@ -0,0 +1,60 @@
+/*******************************************************************************
+ * @file           : img_test.h
+ * @brief          : Host tests of the image processing library (make
+ *                   host-test): case reporting, PPM fixtures and golden
+ *                   images (PAM files).
+ ******************************************************************************/
+
+#ifndef IMG_TEST_H
+#define IMG_TEST_H
+
+#include "stm32_img.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Fill value of the bytes around the strided test images, which no
+ *        kernel may write
+ */
+#define IMG_TEST_CANARY  0xA5
+
+/**
+ * @brief Extra bytes at the end of each line of the strided test images
+ */
+#define IMG_TEST_PAD     12
+
+/* Test suites */
+void ImgTestGoldenSuite(void);
+void ImgTestSimdSuite(void);
+void ImgTestGraySuite(void);
+void ImgTestBicubicSuite(void);
+
+/* Cases: each one runs between ImgTestBegin() and ImgTestEnd(), and fails if
+ * ImgTestFail() is called or an IMG_ASSERT() fails in between */
+void ImgTestBegin(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+void ImgTestFail(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+int ImgTestEnd(void);
+
+/* Images */
+int ImgTestLoadFixture(const char *name, Image_t *img);
+void ImgTestAlloc(Image_t *img, uint32_t width, uint32_t height,
+                  pxfmt_t format, int strided);
+void ImgTestFree(Image_t *img);
+void ImgTestFill(Image_t *img, uint32_t seed);
+int ImgTestEqual(const Image_t *img0, const Image_t *img1);
+void ImgTestCheckCanary(const Image_t *img);
+
+/* Golden images */
+void ImgTestGolden(const char *name, const Image_t *img);
+void ImgTestGoldenData(const char *name, const char *tupltype, uint32_t width,
+                       uint32_t height, uint32_t depth, const void *pData,
+                       uint32_t stride);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IMG_TEST_H */
@@ -0,0 +1,257 @@
+/*******************************************************************************
+ * @file           : img_test_bicubic.c
+ * @brief          : BICUBIC resize accuracy tests: the Q12 fixed point paths
+ *                   (ImgResize()/ImgResizeCrop(), and the tables and line ring
+ *                   of ImgResizeCropEx()) are compared with a double precision
+ *                   Keys (a = -0.5) reference at the same sampling positions,
+ *                   on upscales, downscales and sources smaller than the 4
+ *                   taps, where every tap is clamped to the ROI edges.
+ ******************************************************************************/
+
+#include "img_test.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Largest allowed difference between an output component and the
+ *        reference value before rounding, in units of the component (5 or 6
+ *        bits for RGB565): the half unit of the final rounding, plus the Q12
+ *        weight and Q8 intermediate rounding errors
+ */
+#define IMG_TEST_BICUBIC_MAX_ERROR  0.75
+
+/* Source size and ROI (width 0 for the whole source), destination size */
+typedef struct
+{
+  const char *name;
+  uint32_t srcW;
+  uint32_t srcH;
+  ImgRect_t roi;
+  uint32_t dstW;
+  uint32_t dstH;
+} BicubicCase_t;
+
+static const BicubicCase_t bicubic_cases[] = {
+  {"upscale", 37, 29, {0, 0, 0, 0}, 61, 47},
+  {"upscale 2x", 37, 29, {0, 0, 0, 0}, 74, 58},
+  {"downscale", 37, 29, {0, 0, 0, 0}, 20, 15},
+  {"downscale 4x+", 37, 29, {0, 0, 0, 0}, 9, 7},
+  {"edges 1x1", 1, 1, {0, 0, 0, 0}, 5, 4},
+  {"edges 2x3", 2, 3, {0, 0, 0, 0}, 7, 9},
+  {"edges 3x2", 3, 2, {0, 0, 0, 0}, 8, 5},
+  /* Taps clamped to the ROI, not to the source */
+  {"edges roi top-left", 37, 29, {0, 0, 12, 10}, 30, 25},
+  {"edges roi inner", 37, 29, {13, 9, 11, 10}, 27, 23},
+  {"edges roi bottom-right", 37, 29, {25, 19, 12, 10}, 30, 25},
+};
+
+static const char *const bicubic_formats[] = {"GRAY8", "RGB565", "RGB888",
+                                              "ARGB8888"};
+
+static void Bicubic_Check(const Image_t *src, const ImgRect_t *roi,
+                          const Image_t *dst);
+static double Bicubic_RefKeys(double x);
+static uint32_t Bicubic_Comp(const uint8_t *pPixel, pxfmt_t format,
+                             uint32_t c);
+
+/**
+ * @brief  Runs the BICUBIC accuracy tests, in every pixel format.
+ * @retval None
+ */
+void ImgTestBicubicSuite(void)
+{
+  for (uint32_t i = 0; i < sizeof(bicubic_cases) / sizeof(bicubic_cases[0]); i++)
+  {
+    const BicubicCase_t *bc = &bicubic_cases[i];
+
+    for (pxfmt_t format = PXFMT_GRAY8; format <= PXFMT_ARGB8888; format++)
+    {
+      ImgRect_t roi = bc->roi;
+      const uint32_t ws_size = ImgResizeWsSize(bc->dstW, bc->dstH, BICUBIC);
+      void *pBuffer = aligned_alloc(32, (ws_size + 31) & ~31u);
+      ImgResizeWs_t ws;
+      Image_t src, dst, dst_ex;
+
+      if (roi.width == 0)
+      {
+        roi = (ImgRect_t) {0, 0, bc->srcW, bc->srcH};
+      }
+      ImgTestAlloc(&src, bc->srcW, bc->srcH, format, 0);
+      ImgTestFill(&src, 0xb1c0 + i);
+      ImgTestAlloc(&dst, bc->dstW, bc->dstH, format, 1);
+      ImgTestAlloc(&dst_ex, bc->dstW, bc->dstH, format, 1);
+
+      ImgTestBegin("bicubic ImgResizeCrop %s %s %ux%u to %ux%u", bc->name,
+                   bicubic_formats[format], roi.width, roi.height, bc->dstW,
+                   bc->dstH);
+      ImgResizeCrop(&src, &dst, &roi, BICUBIC);
+      Bicubic_Check(&src, &roi, &dst);
+      ImgTestCheckCanary(&dst);
+      ImgTestEnd();
+
+      ImgTestBegin("bicubic ImgResizeCropEx %s %s %ux%u to %ux%u", bc->name,
+                   bicubic_formats[format], roi.width, roi.height, bc->dstW,
+                   bc->dstH);
+      ImgResizeWsInit(&ws, pBuffer, ws_size);
+      if (ImgResizeCropEx(&src, &dst_ex, &roi, BICUBIC, &ws) != IMG_OK)
+      {
+        ImgTestFail("status not IMG_OK");
+      }
+      Bicubic_Check(&src, &roi, &dst_ex);
+      /* Both paths give the same result */
+      if (!ImgTestEqual(&dst, &dst_ex))
+      {
+        ImgTestFail("differs from ImgResizeCrop()");
+      }
+      ImgTestCheckCanary(&dst_ex);
+      ImgTestEnd();
+
+      ImgTestFree(&src);
+      ImgTestFree(&dst);
+      ImgTestFree(&dst_ex);
+      free(pBuffer);
+    }
+  }
+}
+
+/**
+ * @brief  Compares a BICUBIC resize with the double precision reference, and
+ *         fails the current case if a component of any channel is further
+ *         than IMG_TEST_BICUBIC_MAX_ERROR from it.
+ * @param  src  Source image
+ * @param  roi  Region Of Interest of the source
+ * @param  dst  Resized image
+ * @retval None
+ */
+static void Bicubic_Check(const Image_t *src, const ImgRect_t *roi,
+                          const Image_t *dst)
+{
+  const uint32_t pixel_size = IMG_BYTES_PER_PX(src->format);
+  const uint32_t comps = (src->format == PXFMT_RGB565) ? 3 : pixel_size;
+  /* Same Q16 sampling positions as the library */
+  const uint32_t x_ratio = (roi->width << 16) / dst->width;
+  const uint32_t y_ratio = (roi->height << 16) / dst->height;
+  double max_error[4] = {0.0, 0.0, 0.0, 0.0};
+  uint32_t worst[4][2] = {{0, 0}, {0, 0}, {0, 0}, {0, 0}};
+
+  for (uint32_t y = 0; y < dst->height; y++)
+  {
+    const uint32_t pos_y = y * y_ratio;
+    const double ty = (double) (pos_y & 0xffffu) / 65536.0;
+    int32_t rows[4];
+    double wy[4];
+
+    for (int32_t k = 0; k < 4; k++)
+    {
+      int32_t row = (int32_t) (pos_y >> 16) - 1 + k;
+
+      row = (row < 0) ? 0 : ((row > (int32_t) roi->height - 1) ?
+                             (int32_t) roi->height - 1 : row);
+      rows[k] = (int32_t) roi->y0 + row;
+      wy[k] = Bicubic_RefKeys(ty + 1.0 - k);
+    }
+
+    for (uint32_t x = 0; x < dst->width; x++)
+    {
+      const uint32_t pos_x = x * x_ratio;
+      const double tx = (double) (pos_x & 0xffffu) / 65536.0;
+      const uint8_t *pOut = (const uint8_t *) dst->pData +
+                            y * IMG_STRIDE(dst) + x * pixel_size;
+      int32_t cols[4];
+      double wx[4];
+
+      for (int32_t k = 0; k < 4; k++)
+      {
+        int32_t col = (int32_t) (pos_x >> 16) - 1 + k;
+
+        col = (col < 0) ? 0 : ((col > (int32_t) roi->width - 1) ?
+                               (int32_t) roi->width - 1 : col);
+        cols[k] = (int32_t) roi->x0 + col;
+        wx[k] = Bicubic_RefKeys(tx + 1.0 - k);
+      }
+
+      for (uint32_t c = 0; c < comps; c++)
+      {
+        const double max = (src->format != PXFMT_RGB565) ? 255.0 :
+                           ((c == 1) ? 63.0 : 31.0);
+        double ref = 0.0;
+        double error;
+
+        for (uint32_t j = 0; j < 4; j++)
+        {
+          const uint8_t *pLine = (const uint8_t *) src->pData +
+                                 rows[j] * IMG_STRIDE(src);
+          double h = 0.0;
+
+          for (uint32_t i = 0; i < 4; i++)
+          {
+            h += wx[i] * Bicubic_Comp(pLine + cols[i] * pixel_size,
+                                      src->format, c);
+          }
+          ref += wy[j] * h;
+        }
+        ref = (ref < 0.0) ? 0.0 : ((ref > max) ? max : ref);
+        error = (double) Bicubic_Comp(pOut, dst->format, c) - ref;
+        error = (error < 0.0) ? -error : error;
+        if (error > max_error[c])
+        {
+          max_error[c] = error;
+          worst[c][0] = x;
+          worst[c][1] = y;
+        }
+      }
+    }
+  }
+
+  for (uint32_t c = 0; c < comps; c++)
+  {
+    if (max_error[c] > IMG_TEST_BICUBIC_MAX_ERROR)
+    {
+      ImgTestFail("channel %u: error %.3f at (%u, %u), %.2f allowed", c,
+                  max_error[c], worst[c][0], worst[c][1],
+                  IMG_TEST_BICUBIC_MAX_ERROR);
+    }
+  }
+}
+
+/**
+ * @brief  Keys cubic convolution kernel, a = -0.5.
+ * @param  x  Distance to the sample
+ * @retval Weight
+ */
+static double Bicubic_RefKeys(double x)
+{
+  const double a = -0.5;
+
+  x = (x < 0.0) ? -x : x;
+  if (x <= 1.0)
+  {
+    return ((a + 2.0) * x - (a + 3.0)) * x * x + 1.0;
+  }
+  if (x < 2.0)
+  {
+    return ((a * x - 5.0 * a) * x + 8.0 * a) * x - 4.0 * a;
+  }
+  return 0.0;
+}
+
+/**
+ * @brief  Component of a pixel: byte c, or R, G, B field of a RGB565 pixel.
+ * @param  pPixel  Pixel
+ * @param  format  Pixel format
+ * @param  c       Component index
+ * @retval Component value
+ */
+static uint32_t Bicubic_Comp(const uint8_t *pPixel, pxfmt_t format,
+                             uint32_t c)
+{
+  uint16_t pixel;
+
+  if (format != PXFMT_RGB565)
+  {
+    return pPixel[c];
+  }
+  memcpy(&pixel, pPixel, 2);
+  return (c == 0) ? (pixel >> 11u) : ((c == 1) ? ((pixel >> 5) & 0x3fu) :
+                                      (pixel & 0x1fu));
+}
@@ -0,0 +1,594 @@
+/*******************************************************************************
+ * @file           : img_test_golden.c
+ * @brief          : Golden image tests of the image processing library: every
+ *                   ImgTo*, ImgCrop* and ImgResize* path runs on the PPM
+ *                   fixtures, on packed and on strided images, and its output
+ *                   is compared with the golden image of the case. The
+ *                   strided runs share the golden images of the packed ones
+ *                   and check that the line padding is left untouched.
+ ******************************************************************************/
+
+#include "img_test.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Fixtures and the geometry of their cases */
+typedef struct
+{
+  const char *fixture;   /*!< fixtures/<fixture>.ppm                         */
+  const char *name;      /*!< Golden image name prefix                       */
+  ImgRect_t crop;        /*!< ImgCrop() and ImgCropView() rectangle          */
+  uint32_t center[2];    /*!< ImgCropCenter() destination size               */
+  ImgRect_t roi;         /*!< ImgResizeCrop*() and tensor region             */
+  uint32_t roiDst[2];    /*!< ImgResizeCrop*() destination size              */
+  uint32_t sizes[4][2];  /*!< ImgResize() destination sizes, 0 if unused     */
+} GoldenFixture_t;
+
+static const GoldenFixture_t golden_fixtures[] = {
+  /* Integer ratios (2x, 4x) for the AREA fast paths */
+  {"pattern_48x36", "pattern48x36", {5, 3, 17, 13}, {21, 15}, {6, 4, 32, 24},
+   {13, 10}, {{20, 15}, {24, 18}, {12, 9}, {61, 45}}},
+  /* Odd sizes, for the SIMD kernel tails */
+  {"noise_37x29", "noise37x29", {4, 7, 25, 19}, {23, 17}, {3, 5, 29, 21},
+   {13, 10}, {{13, 11}, {45, 35}, {0, 0}, {0, 0}}},
+};
+
+/* Conversions */
+typedef struct
+{
+  const char *kernel;
+  void (*convert)(Image_t *imgSrc, Image_t *imgDst);
+  pxfmt_t src;
+  pxfmt_t dst;
+} GoldenConvert_t;
+
+static const GoldenConvert_t golden_converts[] = {
+  {"ImgToGrayscale", ImgToGrayscale, PXFMT_RGB565, PXFMT_GRAY8},
+  {"ImgToGrayscale", ImgToGrayscale, PXFMT_RGB888, PXFMT_GRAY8},
+  {"ImgToRGB565", ImgToRGB565, PXFMT_RGB888, PXFMT_RGB565},
+  {"ImgToRGB888", ImgToRGB888, PXFMT_RGB565, PXFMT_RGB888},
+  {"ImgToRGB888", ImgToRGB888, PXFMT_GRAY8, PXFMT_RGB888},
+  {"ImgToARGB8888", ImgToARGB8888, PXFMT_RGB565, PXFMT_ARGB8888},
+  {"ImgToARGB8888", ImgToARGB8888, PXFMT_GRAY8, PXFMT_ARGB8888},
+};
+
+/* Tensors, from the RGB565 fixture */
+typedef struct
+{
+  const char *name;
+  intrpl_t intrpl;
+  ImgTensorParams_t params;
+} GoldenTensor_t;
+
+static const GoldenTensor_t golden_tensors[] = {
+  {"FLOAT32_HWC_RGB", BILINEAR,
+   {TENSOR_FLOAT32, TENSOR_HWC, TENSOR_RGB, 16, 12, {127.5f, 127.5f, 127.5f},
+    {1.0f / 127.5f, 1.0f / 127.5f, 1.0f / 127.5f}, 0.0f, 0}},
+  {"UINT8_CHW_BGR", NEAREST,
+   {TENSOR_UINT8, TENSOR_CHW, TENSOR_BGR, 15, 11, {123.7f, 116.3f, 103.5f},
+    {0.0171f, 0.0175f, 0.0174f}, 0.0183f, 114}},
+  {"INT8_HWC_RGB", BILINEAR,
+   {TENSOR_INT8, TENSOR_HWC, TENSOR_RGB, 16, 12, {0.0f, 0.0f, 0.0f},
+    {1.0f / 255.0f, 1.0f / 255.0f, 1.0f / 255.0f}, 1.0f / 255.0f, -128}},
+};
+
+static const char *const golden_formats[] = {"GRAY8", "RGB565", "RGB888",
+                                             "ARGB8888"};
+static const char *const golden_intrpls[] = {"NEAREST", "BILINEAR", "BICUBIC",
+                                             "AREA"};
+
+/* Completion callback calls of ImgResizeCropAsync() */
+static uint32_t golden_callbacks;
+static imgstatus_t golden_status;
+
+static void Golden_Source(const Image_t *rgb, pxfmt_t format, int strided,
+                          Image_t *img);
+static void Golden_End(const char *golden, const Image_t *img);
+static void Golden_Converts(const GoldenFixture_t *fx, const Image_t *rgb);
+static void Golden_Crops(const GoldenFixture_t *fx, const Image_t *rgb);
+static void Golden_Resizes(const GoldenFixture_t *fx, const Image_t *rgb);
+static void Golden_ResizeCrops(const GoldenFixture_t *fx, const Image_t *rgb);
+static void Golden_Tensors(const GoldenFixture_t *fx, const Image_t *rgb);
+static void Golden_Errors(const Image_t *rgb);
+static void Golden_Callback(imgstatus_t status, void *pContext);
+
+/**
+ * @brief  Runs the golden image tests on every fixture.
+ * @retval None
+ */
+void ImgTestGoldenSuite(void)
+{
+  for (uint32_t f = 0; f < sizeof(golden_fixtures) / sizeof(golden_fixtures[0]); f++)
+  {
+    const GoldenFixture_t *fx = &golden_fixtures[f];
+    Image_t rgb;
+
+    ImgTestBegin("%s fixture", fx->name);
+    if (!ImgTestLoadFixture(fx->fixture, &rgb))
+    {
+      ImgTestEnd();
+      continue;
+    }
+    ImgTestEnd();
+
+    Golden_Converts(fx, &rgb);
+    Golden_Crops(fx, &rgb);
+    Golden_Resizes(fx, &rgb);
+    Golden_ResizeCrops(fx, &rgb);
+    Golden_Tensors(fx, &rgb);
+    if (f == 0)
+    {
+      Golden_Errors(&rgb);
+    }
+    ImgTestFree(&rgb);
+  }
+}
+
+/**
+ * @brief  Makes a source image from an RGB888 fixture, with the reference
+ *         formulas (not the library under test): RGB565 truncation, ITU-R
+ *         BT.601 luma for GRAY8 and opaque alpha for ARGB8888 (bytes A, R, G,
+ *         B as the library stores them).
+ * @param  rgb      Fixture
+ * @param  format   Source format
+ * @param  strided  Whether the source lines are padded
+ * @param  img      Source image, freed with ImgTestFree()
+ * @retval None
+ */
+static void Golden_Source(const Image_t *rgb, pxfmt_t format, int strided,
+                          Image_t *img)
+{
+  ImgTestAlloc(img, rgb->width, rgb->height, format, strided);
+
+  for (uint32_t y = 0; y < rgb->height; y++)
+  {
+    const uint8_t *pIn = (const uint8_t *) rgb->pData + y * IMG_STRIDE(rgb);
+    uint8_t *pOut = (uint8_t *) img->pData + y * IMG_STRIDE(img);
+
+    for (uint32_t x = 0; x < rgb->width; x++, pIn += 3)
+    {
+      const uint32_t r = pIn[0], g = pIn[1], b = pIn[2];
+      uint16_t rgb565;
+
+      switch (format)
+      {
+      case PXFMT_GRAY8:
+        *pOut++ = (uint8_t) ((r * 19595 + g * 38470 + b * 7471 + 0x8000) >> 16);
+        break;
+
+      case PXFMT_RGB565:
+        rgb565 = (uint16_t) (((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+        memcpy(pOut, &rgb565, 2);
+        pOut += 2;
+        break;
+
+      case PXFMT_RGB888:
+        *pOut++ = (uint8_t) r;
+        *pOut++ = (uint8_t) g;
+        *pOut++ = (uint8_t) b;
+        break;
+
+      default:
+        *pOut++ = 0xFF;
+        *pOut++ = (uint8_t) r;
+        *pOut++ = (uint8_t) g;
+        *pOut++ = (uint8_t) b;
+        break;
+      }
+    }
+  }
+}
+
+/**
+ * @brief  Checks the output of a case against its golden image and its line
+ *         padding, then ends the case.
+ * @param  golden  Golden image name
+ * @param  img     Output image
+ * @retval None
+ */
+static void Golden_End(const char *golden, const Image_t *img)
+{
+  ImgTestGolden(golden, img);
+  ImgTestCheckCanary(img);
+  ImgTestEnd();
+}
+
+/**
+ * @brief  ImgToGrayscale(), ImgToRGB565(), ImgToRGB888(), ImgToARGB8888() and
+ *         ImgToARGB8888Scaled() cases.
+ * @param  fx   Fixture
+ * @param  rgb  Fixture image
+ * @retval None
+ */
+static void Golden_Converts(const GoldenFixture_t *fx, const Image_t *rgb)
+{
+  char golden[128];
+
+  for (uint32_t c = 0; c < sizeof(golden_converts) / sizeof(golden_converts[0]); c++)
+  {
+    const GoldenConvert_t *conv = &golden_converts[c];
+
+    snprintf(golden, sizeof(golden), "%s.%s.%s", fx->name, conv->kernel,
+             golden_formats[conv->src]);
+    for (int strided = 0; strided < 2; strided++)
+    {
+      Image_t src, dst;
+
+      ImgTestBegin("%s%s", golden, strided ? " strided" : "");
+      Golden_Source(rgb, conv->src, strided, &src);
+      ImgTestAlloc(&dst, rgb->width, rgb->height, conv->dst, strided);
+      conv->convert(&src, &dst);
+      Golden_End(golden, &dst);
+      ImgTestFree(&src);
+      ImgTestFree(&dst);
+    }
+  }
+
+  /* 2x replicated ARGB8888, the grayscale side output matching ImgToGrayscale */
+  snprintf(golden, sizeof(golden), "%s.ImgToARGB8888Scaled.RGB565", fx->name);
+  for (int strided = 0; strided < 2; strided++)
+  {
+    char gray_golden[128];
+    Image_t src, dst, gray;
+
+    ImgTestBegin("%s%s", golden, strided ? " strided" : "");
+    Golden_Source(rgb, PXFMT_RGB565, strided, &src);
+    ImgTestAlloc(&dst, 2 * rgb->width, 2 * rgb->height, PXFMT_ARGB8888, strided);
+    ImgTestAlloc(&gray, rgb->width, rgb->height, PXFMT_GRAY8, strided);
+    ImgToARGB8888Scaled(&src, &dst, strided ? &gray : NULL);
+    if (strided)
+    {
+      snprintf(gray_golden, sizeof(gray_golden), "%s.ImgToGrayscale.RGB565",
+               fx->name);
+      ImgTestGolden(gray_golden, &gray);
+      ImgTestCheckCanary(&gray);
+    }
+    Golden_End(golden, &dst);
+    ImgTestFree(&src);
+    ImgTestFree(&dst);
+    ImgTestFree(&gray);
+  }
+}
+
+/**
+ * @brief  ImgCrop(), ImgCropView() and ImgCropCenter() cases, in every format.
+ *         The view is checked against the ImgCrop() golden image.
+ * @param  fx   Fixture
+ * @param  rgb  Fixture image
+ * @retval None
+ */
+static void Golden_Crops(const GoldenFixture_t *fx, const Image_t *rgb)
+{
+  char golden[128];
+
+  for (pxfmt_t format = PXFMT_GRAY8; format <= PXFMT_ARGB8888; format++)
+  {
+    for (int strided = 0; strided < 2; strided++)
+    {
+      ImgRect_t crop = fx->crop;
+      Image_t src, dst, view;
+
+      Golden_Source(rgb, format, strided, &src);
+
+      snprintf(golden, sizeof(golden), "%s.ImgCrop.%s", fx->name,
+               golden_formats[format]);
+      ImgTestBegin("%s%s", golden, strided ? " strided" : "");
+      ImgTestAlloc(&dst, crop.width, crop.height, format, strided);
+      ImgCrop(&src, &dst, &crop);
+      Golden_End(golden, &dst);
+      ImgTestFree(&dst);
+
+      ImgTestBegin("%s.ImgCropView.%s%s", fx->name, golden_formats[format],
+                   strided ? " strided" : "");
+      ImgCropView(&src, &view, &crop);
+      if ((view.width != crop.width) || (view.height != crop.height) ||
+          (view.format != format) || (IMG_STRIDE(&view) != IMG_STRIDE(&src)))
+      {
+        ImgTestFail("view %ux%u format %d stride %u", view.width, view.height,
+                    view.format, IMG_STRIDE(&view));
+      }
+      else
+      {
+        ImgTestGolden(golden, &view);
+      }
+      ImgTestEnd();
+
+      snprintf(golden, sizeof(golden), "%s.ImgCropCenter.%s", fx->name,
+               golden_formats[format]);
+      ImgTestBegin("%s%s", golden, strided ? " strided" : "");
+      ImgTestAlloc(&dst, fx->center[0], fx->center[1], format, strided);
+      ImgCropCenter(&src, &dst);
+      Golden_End(golden, &dst);
+      ImgTestFree(&dst);
+
+      ImgTestFree(&src);
+    }
+  }
+}
+
+/**
+ * @brief  ImgResize() and ImgResizeCropEx() (whole image) cases, for every
+ *         method, format and size. ImgResizeCropEx() runs twice on the same
+ *         workspace, the second run reusing the tables of the first.
+ * @param  fx   Fixture
+ * @param  rgb  Fixture image
+ * @retval None
+ */
+static void Golden_Resizes(const GoldenFixture_t *fx, const Image_t *rgb)
+{
+  char golden[128];
+
+  for (uint32_t s = 0; s < 4; s++)
+  {
+    const uint32_t width = fx->sizes[s][0];
+    const uint32_t height = fx->sizes[s][1];
+
+    if (width == 0)
+    {
+      continue;
+    }
+    for (intrpl_t intrpl = NEAREST; intrpl <= AREA; intrpl++)
+    {
+      const uint32_t ws_size = ImgResizeWsSize(width, height, intrpl);
+      void *pBuffer = aligned_alloc(32, (ws_size + 31) & ~31u);
+
+      for (pxfmt_t format = PXFMT_GRAY8; format <= PXFMT_ARGB8888; format++)
+      {
+        for (int strided = 0; strided < 2; strided++)
+        {
+          ImgResizeWs_t ws;
+          Image_t src, dst;
+
+          Golden_Source(rgb, format, strided, &src);
+
+          snprintf(golden, sizeof(golden), "%s.ImgResize.%s.%s.%ux%u",
+                   fx->name, golden_intrpls[intrpl], golden_formats[format],
+                   width, height);
+          ImgTestBegin("%s%s", golden, strided ? " strided" : "");
+          ImgTestAlloc(&dst, width, height, format, strided);
+          ImgResize(&src, &dst, intrpl);
+          Golden_End(golden, &dst);
+          ImgTestFree(&dst);
+
+          snprintf(golden, sizeof(golden), "%s.ImgResizeCropEx.%s.%s.%ux%u",
+                   fx->name, golden_intrpls[intrpl], golden_formats[format],
+                   width, height);
+          ImgTestBegin("%s%s", golden, strided ? " strided" : "");
+          ImgTestAlloc(&dst, width, height, format, strided);
+          ImgResizeWsInit(&ws, pBuffer, ws_size);
+          for (uint32_t run = 0; run < 2; run++)
+          {
+            imgstatus_t status = ImgResizeCropEx(&src, &dst, NULL, intrpl, &ws);
+
+            if (status != IMG_OK)
+            {
+              ImgTestFail("run %u: status %d", run, status);
+            }
+            ImgTestGolden(golden, &dst);
+            ImgTestFill(&dst, run + 1);
+          }
+          ImgTestCheckCanary(&dst);
+          ImgTestEnd();
+          ImgTestFree(&dst);
+
+          ImgTestFree(&src);
+        }
+      }
+      free(pBuffer);
+    }
+  }
+}
+
+/**
+ * @brief  ImgResizeCrop(), ImgResizeCropEx() and ImgResizeCropAsync() cases on
+ *         a Region Of Interest, for every method and format.
+ *         ImgResizeCropAsync() resizes on the CPU on the host: it must match
+ *         ImgResizeCropEx() with a workspace and ImgResizeCrop() without, and
+ *         call back once with IMG_OK.
+ * @param  fx   Fixture
+ * @param  rgb  Fixture image
+ * @retval None
+ */
+static void Golden_ResizeCrops(const GoldenFixture_t *fx, const Image_t *rgb)
+{
+  const uint32_t width = fx->roiDst[0];
+  const uint32_t height = fx->roiDst[1];
+  char golden[128];
+  char golden_ex[128];
+
+  for (intrpl_t intrpl = NEAREST; intrpl <= AREA; intrpl++)
+  {
+    const uint32_t ws_size = ImgResizeWsSize(width, height, intrpl);
+    void *pBuffer = aligned_alloc(32, (ws_size + 31) & ~31u);
+
+    for (pxfmt_t format = PXFMT_GRAY8; format <= PXFMT_ARGB8888; format++)
+    {
+      snprintf(golden, sizeof(golden), "%s.ImgResizeCrop.%s.%s", fx->name,
+               golden_intrpls[intrpl], golden_formats[format]);
+      snprintf(golden_ex, sizeof(golden_ex), "%s.ImgResizeCropEx.%s.%s",
+               fx->name, golden_intrpls[intrpl], golden_formats[format]);
+
+      for (int strided = 0; strided < 2; strided++)
+      {
+        ImgRect_t roi = fx->roi;
+        ImgResizeWs_t ws;
+        Image_t src, dst;
+
+        Golden_Source(rgb, format, strided, &src);
+
+        ImgTestBegin("%s%s", golden, strided ? " strided" : "");
+        ImgTestAlloc(&dst, width, height, format, strided);
+        ImgResizeCrop(&src, &dst, &roi, intrpl);
+        Golden_End(golden, &dst);
+        ImgTestFree(&dst);
+
+        ImgTestBegin("%s%s", golden_ex, strided ? " strided" : "");
+        ImgTestAlloc(&dst, width, height, format, strided);
+        ImgResizeWsInit(&ws, pBuffer, ws_size);
+        if (ImgResizeCropEx(&src, &dst, &roi, intrpl, &ws) != IMG_OK)
+        {
+          ImgTestFail("status not IMG_OK");
+        }
+        Golden_End(golden_ex, &dst);
+        ImgTestFree(&dst);
+
+        for (int with_ws = 0; with_ws < 2; with_ws++)
+        {
+          ImgTestBegin("%s.ImgResizeCropAsync.%s.%s%s%s", fx->name,
+                       golden_intrpls[intrpl], golden_formats[format],
+                       with_ws ? " ws" : "", strided ? " strided" : "");
+          ImgTestAlloc(&dst, width, height, format, strided);
+          ImgResizeWsInit(&ws, pBuffer, ws_size);
+          golden_callbacks = 0;
+          golden_status = IMG_ERROR;
+          if (ImgResizeCropAsync(&src, &dst, &roi, intrpl, with_ws ? &ws : NULL,
+                                 NULL, Golden_Callback, &dst) != IMG_OK)
+          {
+            ImgTestFail("status not IMG_OK");
+          }
+          if ((golden_callbacks != 1) || (golden_status != IMG_OK))
+          {
+            ImgTestFail("%u callbacks, status %d", golden_callbacks,
+                        golden_status);
+          }
+          Golden_End(with_ws ? golden_ex : golden, &dst);
+          ImgTestFree(&dst);
+        }
+
+        ImgTestFree(&src);
+      }
+    }
+    free(pBuffer);
+  }
+}
+
+/**
+ * @brief  ImgResizeCropToTensor() cases: element types, layouts and channel
+ *         orders. The golden images hold the tensor bytes, one line per tensor
+ *         line (per channel plane line for TENSOR_CHW).
+ * @param  fx   Fixture
+ * @param  rgb  Fixture image
+ * @retval None
+ */
+static void Golden_Tensors(const GoldenFixture_t *fx, const Image_t *rgb)
+{
+  static ImgTensor_t tensor;
+  char golden[128];
+  char tupltype[32];
+
+  for (uint32_t t = 0; t < sizeof(golden_tensors) / sizeof(golden_tensors[0]); t++)
+  {
+    const GoldenTensor_t *gt = &golden_tensors[t];
+    const ImgTensorParams_t *params = &gt->params;
+    const uint32_t elem_size = (params->type == TENSOR_FLOAT32) ? 4 : 1;
+    const uint32_t chw = (params->layout == TENSOR_CHW);
+
+    ImgTensorInit(&tensor, params);
+    snprintf(golden, sizeof(golden), "%s.ImgResizeCropToTensor.%s", fx->name,
+             gt->name);
+    snprintf(tupltype, sizeof(tupltype), "TENSOR_%s", gt->name);
+
+    for (int strided = 0; strided < 2; strided++)
+    {
+      const uint32_t size = ImgTensorSize(&tensor);
+      ImgRect_t roi = fx->roi;
+      uint8_t *pOut = aligned_alloc(32, (size + 31) & ~31u);
+      Image_t src;
+
+      ImgTestBegin("%s%s", golden, strided ? " strided" : "");
+      if (size != params->width * params->height * 3 * elem_size)
+      {
+        ImgTestFail("ImgTensorSize() %u", size);
+      }
+      Golden_Source(rgb, PXFMT_RGB565, strided, &src);
+      memset(pOut, IMG_TEST_CANARY, (size + 31) & ~31u);
+      if (ImgResizeCropToTensor(&src, &roi, gt->intrpl, &tensor, pOut) != IMG_OK)
+      {
+        ImgTestFail("status not IMG_OK");
+      }
+      ImgTestGoldenData(golden, tupltype, params->width,
+                        chw ? 3 * params->height : params->height,
+                        chw ? elem_size : 3 * elem_size, pOut,
+                        chw ? params->width * elem_size :
+                        params->width * 3 * elem_size);
+      for (uint32_t i = size; i < ((size + 31) & ~31u); i++)
+      {
+        if (pOut[i] != IMG_TEST_CANARY)
+        {
+          ImgTestFail("byte %u past the tensor overwritten", i - size);
+          break;
+        }
+      }
+      ImgTestEnd();
+      ImgTestFree(&src);
+      free(pOut);
+    }
+  }
+}
+
+/**
+ * @brief  Error statuses: tensor source format and method, resize workspace
+ *         size.
+ * @param  rgb  Fixture image
+ * @retval None
+ */
+static void Golden_Errors(const Image_t *rgb)
+{
+  static ImgTensor_t tensor;
+  static float out[16 * 12 * 3];
+  uint32_t buffer[4];
+  ImgResizeWs_t ws;
+  Image_t src, dst;
+  imgstatus_t status;
+
+  ImgTensorInit(&tensor, &golden_tensors[0].params);
+
+  ImgTestBegin("ImgResizeCropToTensor RGB888 source");
+  Golden_Source(rgb, PXFMT_RGB888, 0, &src);
+  status = ImgResizeCropToTensor(&src, NULL, BILINEAR, &tensor, out);
+  if (status != IMG_ERROR_FORMAT)
+  {
+    ImgTestFail("status %d, IMG_ERROR_FORMAT expected", status);
+  }
+  ImgTestEnd();
+  ImgTestFree(&src);
+
+  ImgTestBegin("ImgResizeCropToTensor BICUBIC");
+  Golden_Source(rgb, PXFMT_RGB565, 0, &src);
+  status = ImgResizeCropToTensor(&src, NULL, BICUBIC, &tensor, out);
+  if (status != IMG_ERROR)
+  {
+    ImgTestFail("status %d, IMG_ERROR expected", status);
+  }
+  ImgTestEnd();
+
+  ImgTestBegin("ImgResizeCropEx workspace too small");
+  ImgTestAlloc(&dst, 20, 15, PXFMT_RGB565, 0);
+  ImgResizeWsInit(&ws, buffer, sizeof(buffer));
+  for (intrpl_t intrpl = BILINEAR; intrpl <= AREA; intrpl++)
+  {
+    status = ImgResizeCropEx(&src, &dst, NULL, intrpl, &ws);
+    if (status != IMG_ERROR_SIZE)
+    {
+      ImgTestFail("%s: status %d, IMG_ERROR_SIZE expected",
+                  golden_intrpls[intrpl], status);
+    }
+  }
+  ImgTestEnd();
+  ImgTestFree(&dst);
+  ImgTestFree(&src);
+}
+
+/**
+ * @brief  ImgResizeCropAsync() completion callback: counts the calls.
+ * @param  status    Completion status
+ * @param  pContext  Destination image
+ * @retval None
+ */
+static void Golden_Callback(imgstatus_t status, void *pContext)
+{
+  (void) pContext;
+  golden_callbacks++;
+  golden_status = status;
+}
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * @file           : img_test_gray.c
+ * @brief          : Grayscale strategy tests: ImgToGrayscale() must give the
+ *                   very same RGB565 conversion with GRAY_ARITH, GRAY_LUT and
+ *                   GRAY_LUT_SPLIT, on every pixel value and on strided
+ *                   images of odd widths.
+ ******************************************************************************/
+
+#include "img_test.h"
+#include <stdio.h>
+#include <string.h>
+
+#if !defined(USE_IMG_GRAY_LUT)
+#error "The grayscale strategy tests need USE_IMG_GRAY_LUT (GRAY_LUT)"
+#endif
+
+static const struct
+{
+  const char *name;
+  graystrat_t strategy;
+} gray_strategies[] = {
+  {"GRAY_ARITH", GRAY_ARITH},
+  {"GRAY_LUT", GRAY_LUT},
+  {"GRAY_LUT_SPLIT", GRAY_LUT_SPLIT},
+};
+
+#define GRAY_STRATEGY_COUNT \
+  (sizeof(gray_strategies) / sizeof(gray_strategies[0]))
+
+static void Gray_Compare(const char *what, Image_t *src, int strided);
+
+/**
+ * @brief  Runs the grayscale strategy tests.
+ * @retval None
+ */
+void ImgTestGraySuite(void)
+{
+  const graystrat_t strategy = ImgGetGrayscaleStrategy();
+  Image_t src;
+
+  /* Every RGB565 value */
+  ImgTestAlloc(&src, 256, 256, PXFMT_RGB565, 0);
+  for (uint32_t i = 0; i < 65536; i++)
+  {
+    ((uint16_t *) src.pData)[i] = (uint16_t) i;
+  }
+  Gray_Compare("all values", &src, 0);
+  ImgTestFree(&src);
+
+  /* Strided, odd widths: line per line with tails */
+  for (uint32_t width = 1; width <= 9; width += 2)
+  {
+    char what[32];
+
+    snprintf(what, sizeof(what), "%ux7 strided", width);
+    ImgTestAlloc(&src, width, 7, PXFMT_RGB565, 1);
+    ImgTestFill(&src, width);
+    Gray_Compare(what, &src, 1);
+    ImgTestFree(&src);
+  }
+
+  ImgSetGrayscaleStrategy(strategy);
+}
+
+/**
+ * @brief  Converts an image with each strategy and checks that the outputs
+ *         are identical to the GRAY_ARITH one, and that no strategy writes
+ *         the destination line padding.
+ * @param  what     Case description
+ * @param  src      RGB565 source image
+ * @param  strided  Whether the destination lines are padded
+ * @retval None
+ */
+static void Gray_Compare(const char *what, Image_t *src, int strided)
+{
+  Image_t dst[GRAY_STRATEGY_COUNT];
+
+  for (uint32_t s = 0; s < GRAY_STRATEGY_COUNT; s++)
+  {
+    ImgTestBegin("gray ImgToGrayscale.RGB565 %s %s", gray_strategies[s].name,
+                 what);
+    ImgTestAlloc(&dst[s], src->width, src->height, PXFMT_GRAY8, strided);
+    ImgSetGrayscaleStrategy(gray_strategies[s].strategy);
+    if (ImgGetGrayscaleStrategy() != gray_strategies[s].strategy)
+    {
+      ImgTestFail("strategy not set");
+    }
+    ImgToGrayscale(src, &dst[s]);
+    if ((s != 0) && !ImgTestEqual(&dst[0], &dst[s]))
+    {
+      for (uint32_t y = 0; y < src->height; y++)
+      {
+        const uint8_t *pRef = (uint8_t *) dst[0].pData + y * IMG_STRIDE(&dst[0]);
+        const uint8_t *pOut = (uint8_t *) dst[s].pData + y * IMG_STRIDE(&dst[s]);
+        uint32_t x = 0;
+
+        while ((x < src->width) && (pRef[x] == pOut[x]))
+        {
+          x++;
+        }
+        if (x < src->width)
+        {
+          ImgTestFail("(%u, %u): %u, %u with %s", x, y, pOut[x], pRef[x],
+                      gray_strategies[0].name);
+          break;
+        }
+      }
+    }
+    ImgTestCheckCanary(&dst[s]);
+    ImgTestEnd();
+  }
+
+  for (uint32_t s = 0; s < GRAY_STRATEGY_COUNT; s++)
+  {
+    ImgTestFree(&dst[s]);
+  }
+}
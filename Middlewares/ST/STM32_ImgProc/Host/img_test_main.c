@@ -0,0 +1,480 @@
+/*******************************************************************************
+ * @file           : img_test_main.c
+ * @brief          : Host entry point of the image processing library tests
+ *                   (make host-test): runs the test suites, reports one line
+ *                   per case and exits with 1 if any case failed.
+ *                   Usage: img_test [--update] <test directory>, the
+ *                   directory holding fixtures/ (PPM input images) and
+ *                   golden/ (PAM expected outputs). With --update, the golden
+ *                   images are written instead of checked.
+ ******************************************************************************/
+
+#include "img_test.h"
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test directory and mode, from the command line */
+static const char *test_dir = NULL;
+static int test_update = 0;
+
+/* Current case: name, failed checks (and failed IMG_ASSERT()) */
+static char test_name[160];
+static uint32_t test_failures = 0;
+
+/* Totals */
+static uint32_t test_cases = 0;
+static uint32_t test_failed = 0;
+static uint32_t test_written = 0;
+
+static int ReadHeaderToken(FILE *file, char *token, size_t size);
+
+int main(int argc, char **argv)
+{
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "--update") == 0)
+    {
+      test_update = 1;
+    }
+    else
+    {
+      test_dir = argv[i];
+    }
+  }
+  if (test_dir == NULL)
+  {
+    fprintf(stderr, "usage: %s [--update] <test directory>\n", argv[0]);
+    return 2;
+  }
+
+  printf("img_test: %s kernels\n", IMG_USE_SIMD ? "SIMD" : "portable C");
+  ImgTestGoldenSuite();
+  ImgTestSimdSuite();
+  ImgTestGraySuite();
+  ImgTestBicubicSuite();
+
+  if (test_update)
+  {
+    printf("%u cases, %u failed, %u golden images written\n", test_cases,
+           test_failed, test_written);
+  }
+  else
+  {
+    printf("%u cases, %u failed\n", test_cases, test_failed);
+  }
+  return (test_failed != 0) ? 1 : 0;
+}
+
+/* Reporting -----------------------------------------------------------------*/
+/**
+ * @brief  Starts a case.
+ * @param  fmt  Case name, printf format
+ * @retval None
+ */
+void ImgTestBegin(const char *fmt, ...)
+{
+  va_list args;
+
+  va_start(args, fmt);
+  vsnprintf(test_name, sizeof(test_name), fmt, args);
+  va_end(args);
+  test_failures = 0;
+}
+
+/**
+ * @brief  Records a failed check of the current case.
+ * @param  fmt  Reason, printf format
+ * @retval None
+ */
+void ImgTestFail(const char *fmt, ...)
+{
+  va_list args;
+
+  printf("  %s: ", test_name);
+  va_start(args, fmt);
+  vprintf(fmt, args);
+  va_end(args);
+  printf("\n");
+  test_failures++;
+}
+
+/**
+ * @brief  Ends the current case and reports it.
+ * @retval 1 if it passed, else 0
+ */
+int ImgTestEnd(void)
+{
+  test_cases++;
+  if (test_failures != 0)
+  {
+    test_failed++;
+    printf("FAIL %s\n", test_name);
+    return 0;
+  }
+  printf("ok   %s\n", test_name);
+  return 1;
+}
+
+/**
+ * @brief  IMG_ASSERT() failure: fails the current case.
+ * @param  function  Function name
+ * @param  file      Source file
+ * @param  line      Source line
+ * @retval None
+ */
+void img_assert_failed(char *function, char *file, uint32_t line)
+{
+  ImgTestFail("IMG_ASSERT failed in %s (%s:%u)", function, file,
+              (unsigned) line);
+}
+
+/* Images --------------------------------------------------------------------*/
+/**
+ * @brief  Loads a fixture, fixtures/<name>.ppm (binary PPM, 8-bit), as a
+ *         packed RGB888 image.
+ * @param  name  Fixture name
+ * @param  img   Image to fill in, freed with ImgTestFree()
+ * @retval 1 if loaded, else 0 (the current case fails)
+ */
+int ImgTestLoadFixture(const char *name, Image_t *img)
+{
+  char path[512];
+  char token[32];
+  uint32_t values[3];
+  FILE *file;
+
+  snprintf(path, sizeof(path), "%s/fixtures/%s.ppm", test_dir, name);
+  file = fopen(path, "rb");
+  if (file == NULL)
+  {
+    ImgTestFail("cannot open %s: %s", path, strerror(errno));
+    return 0;
+  }
+  if (!ReadHeaderToken(file, token, sizeof(token)) || (strcmp(token, "P6") != 0))
+  {
+    ImgTestFail("%s: not a binary PPM", path);
+    fclose(file);
+    return 0;
+  }
+  for (uint32_t i = 0; i < 3; i++)
+  {
+    if (!ReadHeaderToken(file, token, sizeof(token)))
+    {
+      ImgTestFail("%s: truncated header", path);
+      fclose(file);
+      return 0;
+    }
+    values[i] = (uint32_t) strtoul(token, NULL, 10);
+  }
+  if (values[2] != 255)
+  {
+    ImgTestFail("%s: maxval %u, 255 expected", path, values[2]);
+    fclose(file);
+    return 0;
+  }
+
+  ImgTestAlloc(img, values[0], values[1], PXFMT_RGB888, 0);
+  if (fread(img->pData, 3, values[0] * values[1], file) != values[0] * values[1])
+  {
+    ImgTestFail("%s: truncated data", path);
+    ImgTestFree(img);
+    fclose(file);
+    return 0;
+  }
+  fclose(file);
+  return 1;
+}
+
+/**
+ * @brief  Allocates a test image, filled with IMG_TEST_CANARY.
+ * @param  img      Image to fill in, freed with ImgTestFree()
+ * @param  width    Image width
+ * @param  height   Image height
+ * @param  format   Pixel format
+ * @param  strided  0 for a packed image, 1 for IMG_TEST_PAD extra bytes at the
+ *                  end of each line
+ * @retval None
+ */
+void ImgTestAlloc(Image_t *img, uint32_t width, uint32_t height,
+                  pxfmt_t format, int strided)
+{
+  const uint32_t line = width * IMG_BYTES_PER_PX(format);
+  const uint32_t stride = strided ? line + IMG_TEST_PAD : line;
+  /* 32-byte aligned, as the frame buffers on the target */
+  const size_t size = ((size_t) stride * height + 31) & ~(size_t) 31;
+
+  img->width = width;
+  img->height = height;
+  img->format = format;
+  img->stride = strided ? stride : 0;
+  img->pData = aligned_alloc(32, (size != 0) ? size : 32);
+  if (img->pData == NULL)
+  {
+    fprintf(stderr, "img_test: out of memory\n");
+    exit(2);
+  }
+  memset(img->pData, IMG_TEST_CANARY, size);
+}
+
+/**
+ * @brief  Frees a test image.
+ * @param  img  Image allocated by ImgTestAlloc() or ImgTestLoadFixture()
+ * @retval None
+ */
+void ImgTestFree(Image_t *img)
+{
+  free(img->pData);
+  img->pData = NULL;
+}
+
+/**
+ * @brief  Fills the pixels of an image with pseudo-random bytes (fixed seed
+ *         LCG), leaving the line padding as is.
+ * @param  img   Image
+ * @param  seed  Seed
+ * @retval None
+ */
+void ImgTestFill(Image_t *img, uint32_t seed)
+{
+  const uint32_t line = img->width * IMG_BYTES_PER_PX(img->format);
+  uint8_t *pLine = (uint8_t *) img->pData;
+  uint32_t state = seed;
+
+  for (uint32_t y = 0; y < img->height; y++, pLine += IMG_STRIDE(img))
+  {
+    for (uint32_t i = 0; i < line; i++)
+    {
+      state = state * 1664525u + 1013904223u;
+      pLine[i] = (uint8_t) (state >> 24);
+    }
+  }
+}
+
+/**
+ * @brief  Compares the pixels of two images of the same size and format,
+ *         whatever their line pitch.
+ * @param  img0  First image
+ * @param  img1  Second image
+ * @retval 1 if equal, else 0
+ */
+int ImgTestEqual(const Image_t *img0, const Image_t *img1)
+{
+  const uint32_t line = img0->width * IMG_BYTES_PER_PX(img0->format);
+
+  if ((img0->width != img1->width) || (img0->height != img1->height) ||
+      (img0->format != img1->format))
+  {
+    return 0;
+  }
+  for (uint32_t y = 0; y < img0->height; y++)
+  {
+    if (memcmp((uint8_t *) img0->pData + y * IMG_STRIDE(img0),
+               (uint8_t *) img1->pData + y * IMG_STRIDE(img1), line) != 0)
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/**
+ * @brief  Checks that the line padding of a strided image still holds
+ *         IMG_TEST_CANARY, i.e. that no kernel wrote past the image width.
+ * @param  img  Image allocated by ImgTestAlloc()
+ * @retval None
+ */
+void ImgTestCheckCanary(const Image_t *img)
+{
+  const uint32_t line = img->width * IMG_BYTES_PER_PX(img->format);
+  const uint8_t *pLine = (const uint8_t *) img->pData;
+
+  for (uint32_t y = 0; y < img->height; y++, pLine += IMG_STRIDE(img))
+  {
+    for (uint32_t i = line; i < IMG_STRIDE(img); i++)
+    {
+      if (pLine[i] != IMG_TEST_CANARY)
+      {
+        ImgTestFail("padding byte %u of line %u overwritten", i - line, y);
+        return;
+      }
+    }
+  }
+}
+
+/* Golden images -------------------------------------------------------------*/
+/**
+ * @brief  Checks an image against its golden image, golden/<name>.pam, or
+ *         writes it in update mode. The PAM tuple type is the pixel format
+ *         name and each tuple holds the pixel bytes as stored in memory.
+ * @param  name  Golden image name
+ * @param  img   Image
+ * @retval None
+ */
+void ImgTestGolden(const char *name, const Image_t *img)
+{
+  static const char *const tupltypes[] = {"GRAY8", "RGB565", "RGB888",
+                                          "ARGB8888"};
+
+  ImgTestGoldenData(name, tupltypes[img->format], img->width, img->height,
+                    IMG_BYTES_PER_PX(img->format), img->pData, IMG_STRIDE(img));
+}
+
+/**
+ * @brief  Checks raw data against its golden image, golden/<name>.pam, or
+ *         writes it in update mode.
+ * @param  name      Golden image name
+ * @param  tupltype  PAM tuple type, describing the data
+ * @param  width     Width in tuples
+ * @param  height    Height in lines
+ * @param  depth     Bytes per tuple
+ * @param  pData     Data
+ * @param  stride    Line pitch of the data in bytes
+ * @retval None
+ */
+void ImgTestGoldenData(const char *name, const char *tupltype, uint32_t width,
+                       uint32_t height, uint32_t depth, const void *pData,
+                       uint32_t stride)
+{
+  const uint32_t line = width * depth;
+  const uint8_t *pLine = (const uint8_t *) pData;
+  char path[512];
+  char token[32];
+  char type[32] = "";
+  uint32_t header[4] = {0, 0, 0, 0}; /* WIDTH HEIGHT DEPTH MAXVAL */
+  uint8_t *pGolden;
+  FILE *file;
+
+  snprintf(path, sizeof(path), "%s/golden/%s.pam", test_dir, name);
+
+  if (test_update)
+  {
+    file = fopen(path, "wb");
+    if (file == NULL)
+    {
+      ImgTestFail("cannot write %s: %s", path, strerror(errno));
+      return;
+    }
+    fprintf(file, "P7\nWIDTH %u\nHEIGHT %u\nDEPTH %u\nMAXVAL 255\n"
+            "TUPLTYPE %s\nENDHDR\n", width, height, depth, tupltype);
+    for (uint32_t y = 0; y < height; y++, pLine += stride)
+    {
+      fwrite(pLine, 1, line, file);
+    }
+    fclose(file);
+    test_written++;
+    return;
+  }
+
+  file = fopen(path, "rb");
+  if (file == NULL)
+  {
+    ImgTestFail("no golden image %s (make host-test-update)", path);
+    return;
+  }
+  if (!ReadHeaderToken(file, token, sizeof(token)) || (strcmp(token, "P7") != 0))
+  {
+    ImgTestFail("%s: not a PAM file", path);
+    fclose(file);
+    return;
+  }
+  while (ReadHeaderToken(file, token, sizeof(token)) &&
+         (strcmp(token, "ENDHDR") != 0))
+  {
+    static const char *const keys[] = {"WIDTH", "HEIGHT", "DEPTH", "MAXVAL"};
+    char value[32];
+
+    if (!ReadHeaderToken(file, value, sizeof(value)))
+    {
+      break;
+    }
+    for (uint32_t k = 0; k < 4; k++)
+    {
+      if (strcmp(token, keys[k]) == 0)
+      {
+        header[k] = (uint32_t) strtoul(value, NULL, 10);
+      }
+    }
+    if (strcmp(token, "TUPLTYPE") == 0)
+    {
+      snprintf(type, sizeof(type), "%s", value);
+    }
+  }
+  if ((header[0] != width) || (header[1] != height) || (header[2] != depth) ||
+      (strcmp(type, tupltype) != 0))
+  {
+    ImgTestFail("%ux%u %s (depth %u), %ux%u %s (depth %u) expected", width,
+                height, tupltype, depth, header[0], header[1], type, header[2]);
+    fclose(file);
+    return;
+  }
+
+  pGolden = malloc((line != 0) ? line : 1);
+  for (uint32_t y = 0; y < height; y++, pLine += stride)
+  {
+    if (fread(pGolden, 1, line, file) != line)
+    {
+      ImgTestFail("%s: truncated data", path);
+      break;
+    }
+    if (memcmp(pGolden, pLine, line) != 0)
+    {
+      uint32_t i = 0;
+
+      while (pGolden[i] == pLine[i])
+      {
+        i++;
+      }
+      ImgTestFail("differs at (%u, %u) byte %u: %u, %u expected", i / depth,
+                  y, i % depth, pLine[i], pGolden[i]);
+      break;
+    }
+  }
+  free(pGolden);
+  fclose(file);
+}
+
+/**
+ * @brief  Reads a token of a netpbm header (skipping white space and
+ *         comments), and the single white space character after it.
+ * @param  file   File
+ * @param  token  Token
+ * @param  size   Size of token
+ * @retval 1 if read, 0 at the end of the file
+ */
+static int ReadHeaderToken(FILE *file, char *token, size_t size)
+{
+  size_t len = 0;
+  int c = fgetc(file);
+
+  for (;;)
+  {
+    if (c == '#')
+    {
+      while ((c != EOF) && (c != '\n'))
+      {
+        c = fgetc(file);
+      }
+    }
+    else if ((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n'))
+    {
+      c = fgetc(file);
+    }
+    else
+    {
+      break;
+    }
+  }
+  while ((c != EOF) && (c != ' ') && (c != '\t') && (c != '\r') && (c != '\n'))
+  {
+    if (len + 1 < size)
+    {
+      token[len++] = (char) c;
+    }
+    c = fgetc(file);
+  }
+  token[len] = '\0';
+  return len != 0;
+}
@@ -0,0 +1,400 @@
+/*******************************************************************************
+ * @file           : img_test_simd.c
+ * @brief          : Bit-exactness tests of the color converters: each ImgTo*
+ *                   conversion is checked against per-pixel reference
+ *                   formulas (those of the portable C kernels) on every
+ *                   width from 1 to IMG_TEST_SIMD_MAX_WIDTH, at every source
+ *                   and destination alignment, packed and strided. Both
+ *                   host-test builds run them: the SIMD kernels, their tails
+ *                   and the portable C kernels must all give the reference
+ *                   bytes, and write nothing else.
+ ******************************************************************************/
+
+#include "img_test.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Widths 1 to 35 cover every SIMD block (2 or 4 pixels) tail several times */
+#define IMG_TEST_SIMD_MAX_WIDTH  35
+#define IMG_TEST_SIMD_HEIGHT     3
+
+/* Bytes around the destination that no conversion may write */
+#define IMG_TEST_SIMD_GUARD      8
+
+/* Conversions */
+typedef struct
+{
+  const char *kernel;
+  void (*convert)(Image_t *imgSrc, Image_t *imgDst);
+  pxfmt_t src;
+  pxfmt_t dst;
+} SimdConvert_t;
+
+static const SimdConvert_t simd_converts[] = {
+  {"ImgToGrayscale", ImgToGrayscale, PXFMT_RGB565, PXFMT_GRAY8},
+  {"ImgToGrayscale", ImgToGrayscale, PXFMT_RGB888, PXFMT_GRAY8},
+  {"ImgToRGB565", ImgToRGB565, PXFMT_RGB888, PXFMT_RGB565},
+  {"ImgToRGB888", ImgToRGB888, PXFMT_RGB565, PXFMT_RGB888},
+  {"ImgToRGB888", ImgToRGB888, PXFMT_GRAY8, PXFMT_RGB888},
+  {"ImgToARGB8888", ImgToARGB8888, PXFMT_RGB565, PXFMT_ARGB8888},
+  {"ImgToARGB8888", ImgToARGB8888, PXFMT_GRAY8, PXFMT_ARGB8888},
+};
+
+static const char *const simd_formats[] = {"GRAY8", "RGB565", "RGB888",
+                                           "ARGB8888"};
+
+static void Simd_Exhaustive(const SimdConvert_t *conv);
+static void Simd_Widths(const SimdConvert_t *conv);
+static void Simd_Scaled(void);
+static void Simd_RefPixel(pxfmt_t src, pxfmt_t dst, const uint8_t *pIn,
+                          uint8_t *pOut);
+static uint8_t Simd_RefGray565(uint32_t pixel);
+static uint32_t Simd_Check(const uint8_t *pOut, const uint8_t *pRef,
+                           uint32_t size);
+
+/**
+ * @brief  Runs the converter bit-exactness tests.
+ * @retval None
+ */
+void ImgTestSimdSuite(void)
+{
+  const graystrat_t strategy = ImgGetGrayscaleStrategy();
+
+  /* The SIMD RGB565 to grayscale kernel is the arithmetic strategy */
+  ImgSetGrayscaleStrategy(GRAY_ARITH);
+  for (uint32_t c = 0; c < sizeof(simd_converts) / sizeof(simd_converts[0]); c++)
+  {
+    Simd_Exhaustive(&simd_converts[c]);
+    Simd_Widths(&simd_converts[c]);
+  }
+  Simd_Scaled();
+  ImgSetGrayscaleStrategy(strategy);
+}
+
+/**
+ * @brief  Converts every source value: all 65536 RGB565 pixels, all 256 gray
+ *         levels, or 65536 pseudo-random RGB888 pixels, as one packed image.
+ * @param  conv  Conversion
+ * @retval None
+ */
+static void Simd_Exhaustive(const SimdConvert_t *conv)
+{
+  const uint32_t width = (conv->src == PXFMT_GRAY8) ? 16 : 256;
+  const uint32_t height = (conv->src == PXFMT_GRAY8) ? 16 : 256;
+  const uint32_t src_size = IMG_BYTES_PER_PX(conv->src);
+  const uint32_t dst_size = IMG_BYTES_PER_PX(conv->dst);
+  uint8_t *pRef = malloc(width * height * dst_size);
+  Image_t src, dst;
+  uint32_t diff;
+
+  ImgTestBegin("simd %s.%s all values", conv->kernel, simd_formats[conv->src]);
+  ImgTestAlloc(&src, width, height, conv->src, 0);
+  ImgTestAlloc(&dst, width, height, conv->dst, 0);
+  if (conv->src == PXFMT_RGB888)
+  {
+    ImgTestFill(&src, 0x5eed);
+  }
+  else
+  {
+    for (uint32_t i = 0; i < width * height; i++)
+    {
+      if (conv->src == PXFMT_RGB565)
+      {
+        ((uint16_t *) src.pData)[i] = (uint16_t) i;
+      }
+      else
+      {
+        ((uint8_t *) src.pData)[i] = (uint8_t) i;
+      }
+    }
+  }
+  for (uint32_t i = 0; i < width * height; i++)
+  {
+    Simd_RefPixel(conv->src, conv->dst, (uint8_t *) src.pData + i * src_size,
+                  pRef + i * dst_size);
+  }
+
+  conv->convert(&src, &dst);
+  diff = Simd_Check(dst.pData, pRef, width * height * dst_size);
+  if (diff != UINT32_MAX)
+  {
+    ImgTestFail("pixel %u byte %u: %u, %u expected", diff / dst_size,
+                diff % dst_size, ((uint8_t *) dst.pData)[diff], pRef[diff]);
+  }
+  ImgTestEnd();
+  ImgTestFree(&src);
+  ImgTestFree(&dst);
+  free(pRef);
+}
+
+/**
+ * @brief  Converts images of every width up to IMG_TEST_SIMD_MAX_WIDTH, with
+ *         the source and destination at every offset from a 4-byte boundary
+ *         (every 2-byte one for RGB565), packed and strided, and checks the
+ *         whole destination buffer: reference pixels, untouched guard bytes
+ *         and line padding.
+ * @param  conv  Conversion
+ * @retval None
+ */
+static void Simd_Widths(const SimdConvert_t *conv)
+{
+  const uint32_t src_size = IMG_BYTES_PER_PX(conv->src);
+  const uint32_t dst_size = IMG_BYTES_PER_PX(conv->dst);
+  const uint32_t src_step = (conv->src == PXFMT_RGB565) ? 2 : 1;
+  const uint32_t dst_step = (conv->dst == PXFMT_RGB565) ? 2 : 1;
+  const uint32_t buf_size = 2 * IMG_TEST_SIMD_GUARD + IMG_TEST_SIMD_HEIGHT *
+                            (IMG_TEST_SIMD_MAX_WIDTH * 4 + IMG_TEST_PAD);
+  uint8_t *pSrcBuf = aligned_alloc(32, (buf_size + 31) & ~31u);
+  uint8_t *pDstBuf = aligned_alloc(32, (buf_size + 31) & ~31u);
+  uint8_t *pRefBuf = malloc(buf_size);
+  uint32_t state = 0x1234567u;
+
+  ImgTestBegin("simd %s.%s widths 1-%u, alignments, strides", conv->kernel,
+               simd_formats[conv->src], IMG_TEST_SIMD_MAX_WIDTH);
+  for (uint32_t i = 0; i < buf_size; i++)
+  {
+    state = state * 1664525u + 1013904223u;
+    pSrcBuf[i] = (uint8_t) (state >> 24);
+  }
+
+  for (uint32_t width = 1; width <= IMG_TEST_SIMD_MAX_WIDTH; width++)
+  {
+    for (int strided = 0; strided < 2; strided++)
+    {
+      for (uint32_t src_off = 0; src_off < 4; src_off += src_step)
+      {
+        for (uint32_t dst_off = 0; dst_off < 4; dst_off += dst_step)
+        {
+          const uint32_t pad = strided ? IMG_TEST_PAD : 0;
+          Image_t src = {width, IMG_TEST_SIMD_HEIGHT,
+                         pSrcBuf + IMG_TEST_SIMD_GUARD + src_off, conv->src,
+                         width * src_size + pad};
+          Image_t dst = {width, IMG_TEST_SIMD_HEIGHT,
+                         pDstBuf + IMG_TEST_SIMD_GUARD + dst_off, conv->dst,
+                         width * dst_size + pad};
+          uint32_t diff;
+
+          memset(pDstBuf, IMG_TEST_CANARY, buf_size);
+          memset(pRefBuf, IMG_TEST_CANARY, buf_size);
+          for (uint32_t y = 0; y < src.height; y++)
+          {
+            for (uint32_t x = 0; x < width; x++)
+            {
+              Simd_RefPixel(conv->src, conv->dst,
+                            (uint8_t *) src.pData + y * src.stride + x * src_size,
+                            pRefBuf + IMG_TEST_SIMD_GUARD + dst_off +
+                            y * dst.stride + x * dst_size);
+            }
+          }
+
+          conv->convert(&src, &dst);
+          diff = Simd_Check(pDstBuf, pRefBuf, buf_size);
+          if (diff != UINT32_MAX)
+          {
+            const int32_t pos = (int32_t) diff -
+                                (int32_t) (IMG_TEST_SIMD_GUARD + dst_off);
+
+            ImgTestFail("width %u%s, offsets %u/%u: byte %d of the "
+                        "destination: %u, %u expected", width,
+                        strided ? " strided" : "", src_off, dst_off, pos,
+                        pDstBuf[diff], pRefBuf[diff]);
+            goto end;
+          }
+        }
+      }
+    }
+  }
+
+end:
+  ImgTestEnd();
+  free(pSrcBuf);
+  free(pDstBuf);
+  free(pRefBuf);
+}
+
+/**
+ * @brief  ImgToARGB8888Scaled(): every width up to IMG_TEST_SIMD_MAX_WIDTH,
+ *         packed and strided, with the 2-byte source offset, against the
+ *         reference gray level replicated 2x2 as opaque pixels, and its
+ *         grayscale side output.
+ * @retval None
+ */
+static void Simd_Scaled(void)
+{
+  ImgTestBegin("simd ImgToARGB8888Scaled.RGB565 widths 1-%u, alignments, "
+               "strides", IMG_TEST_SIMD_MAX_WIDTH);
+
+  for (uint32_t width = 1; width <= IMG_TEST_SIMD_MAX_WIDTH; width++)
+  {
+    for (int strided = 0; strided < 2; strided++)
+    {
+      for (uint32_t src_off = 0; src_off < 4; src_off += 2)
+      {
+        Image_t src, dst, gray;
+        Image_t view;
+        ImgRect_t rect = {src_off / 2, 0, width, IMG_TEST_SIMD_HEIGHT};
+        int failed = 0;
+
+        /* Source view one pixel into a wider image for the offset */
+        ImgTestAlloc(&src, width + 1, IMG_TEST_SIMD_HEIGHT, PXFMT_RGB565,
+                     strided);
+        ImgTestFill(&src, width);
+        ImgCropView(&src, &view, &rect);
+        ImgTestAlloc(&dst, 2 * width, 2 * IMG_TEST_SIMD_HEIGHT, PXFMT_ARGB8888,
+                     strided);
+        ImgTestAlloc(&gray, width, IMG_TEST_SIMD_HEIGHT, PXFMT_GRAY8, strided);
+
+        ImgToARGB8888Scaled(&view, &dst, &gray);
+
+        for (uint32_t y = 0; (y < view.height) && !failed; y++)
+        {
+          for (uint32_t x = 0; (x < width) && !failed; x++)
+          {
+            uint16_t pixel;
+            uint8_t level;
+
+            memcpy(&pixel, (uint8_t *) view.pData + y * IMG_STRIDE(&view) +
+                   2 * x, 2);
+            level = Simd_RefGray565(pixel);
+            if (((uint8_t *) gray.pData)[y * IMG_STRIDE(&gray) + x] != level)
+            {
+              ImgTestFail("width %u%s, offset %u: gray (%u, %u)", width,
+                          strided ? " strided" : "", src_off, x, y);
+              failed = 1;
+            }
+            for (uint32_t i = 0; (i < 4) && !failed; i++)
+            {
+              const uint8_t *pOut = (uint8_t *) dst.pData +
+                                    (2 * y + i / 2) * IMG_STRIDE(&dst) +
+                                    (2 * x + i % 2) * 4;
+              /* 0xFF000000 | level * 0x010101 in memory */
+              if ((pOut[0] != level) || (pOut[1] != level) ||
+                  (pOut[2] != level) || (pOut[3] != 0xFF))
+              {
+                ImgTestFail("width %u%s, offset %u: ARGB8888 (%u, %u)", width,
+                            strided ? " strided" : "", src_off,
+                            2 * x + i % 2, 2 * y + i / 2);
+                failed = 1;
+              }
+            }
+          }
+        }
+        ImgTestCheckCanary(&dst);
+        ImgTestCheckCanary(&gray);
+        ImgTestFree(&src);
+        ImgTestFree(&dst);
+        ImgTestFree(&gray);
+        if (failed)
+        {
+          ImgTestEnd();
+          return;
+        }
+      }
+    }
+  }
+  ImgTestEnd();
+}
+
+/**
+ * @brief  Reference conversion of one pixel: the portable C formulas.
+ * @param  src   Source format
+ * @param  dst   Destination format
+ * @param  pIn   Source pixel
+ * @param  pOut  Destination pixel
+ * @retval None
+ */
+static void Simd_RefPixel(pxfmt_t src, pxfmt_t dst, const uint8_t *pIn,
+                          uint8_t *pOut)
+{
+  uint32_t r, g, b;
+  uint16_t pixel;
+
+  switch (src)
+  {
+  case PXFMT_GRAY8:
+    r = g = b = pIn[0];
+    break;
+
+  case PXFMT_RGB565:
+    memcpy(&pixel, pIn, 2);
+    if (dst == PXFMT_GRAY8)
+    {
+      *pOut = Simd_RefGray565(pixel);
+      return;
+    }
+    /* MSBs replicated to the LSBs */
+    r = (pixel >> 11) & 0x1fu;
+    g = (pixel >> 5) & 0x3fu;
+    b = pixel & 0x1fu;
+    r = (r << 3) | (r >> 2);
+    g = (g << 2) | (g >> 4);
+    b = (b << 3) | (b >> 2);
+    break;
+
+  default:
+    r = pIn[0];
+    g = pIn[1];
+    b = pIn[2];
+    break;
+  }
+
+  switch (dst)
+  {
+  case PXFMT_GRAY8:
+    *pOut = (uint8_t) ((r * 19595 + g * 38470 + b * 7471 + 0x8000) >> 16);
+    break;
+
+  case PXFMT_RGB565:
+    pixel = (uint16_t) (((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+    memcpy(pOut, &pixel, 2);
+    break;
+
+  case PXFMT_RGB888:
+    pOut[0] = (uint8_t) r;
+    pOut[1] = (uint8_t) g;
+    pOut[2] = (uint8_t) b;
+    break;
+
+  default:
+    pOut[0] = 0xFF;
+    pOut[1] = (uint8_t) r;
+    pOut[2] = (uint8_t) g;
+    pOut[3] = (uint8_t) b;
+    break;
+  }
+}
+
+/**
+ * @brief  Reference gray level of a RGB565 pixel: components shifted to 8
+ *         bits (no LSB replication), ITU-R BT.601 weights, rounded.
+ * @param  pixel  RGB565 pixel
+ * @retval Gray level
+ */
+static uint8_t Simd_RefGray565(uint32_t pixel)
+{
+  const uint32_t r = (pixel & 0xf800u) >> 8;
+  const uint32_t g = (pixel & 0x07e0u) >> 3;
+  const uint32_t b = (pixel & 0x001fu) << 3;
+
+  return (uint8_t) ((r * 19595 + g * 38470 + b * 7471 + 0x8000) >> 16);
+}
+
+/**
+ * @brief  Compares two buffers.
+ * @param  pOut  Output
+ * @param  pRef  Reference
+ * @param  size  Size in bytes
+ * @retval Offset of the first differing byte, UINT32_MAX if equal
+ */
+static uint32_t Simd_Check(const uint8_t *pOut, const uint8_t *pRef,
+                           uint32_t size)
+{
+  for (uint32_t i = 0; i < size; i++)
+  {
+    if (pOut[i] != pRef[i])
+    {
+      return i;
+    }
+  }
+  return UINT32_MAX;
+}
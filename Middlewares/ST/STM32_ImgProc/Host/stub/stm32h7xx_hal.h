@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * @file           : stm32h7xx_hal.h
+ * @brief          : Host stub of the STM32H7 HAL for the image processing
+ *                   library tests (make host-test): no peripheral (DMA2D is
+ *                   not defined, its paths are left out), and portable C
+ *                   versions of the CMSIS intrinsics used by the SIMD kernels,
+ *                   so that these run on the host with IMG_USE_SIMD=1.
+ ******************************************************************************/
+
+#ifndef STM32H7XX_HAL_STUB_H
+#define STM32H7XX_HAL_STUB_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef __weak
+#define __weak  __attribute__((weak))
+#endif
+
+/* Unaligned 32-bit access, as in cmsis_gcc.h */
+struct __attribute__((packed)) T_UINT32 { uint32_t v; };
+#define __UNALIGNED_UINT32(x)  (((struct T_UINT32 *)(x))->v)
+
+/**
+ * @brief  Rotate right (ROR)
+ */
+static inline uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+  op2 %= 32u;
+  return (op2 == 0u) ? op1 : ((op1 >> op2) | (op1 << (32u - op2)));
+}
+
+/**
+ * @brief  Zero-extends bytes 0 and 2 to halfwords (UXTB16)
+ */
+static inline uint32_t __UXTB16(uint32_t op1)
+{
+  return op1 & 0x00ff00ffu;
+}
+
+/**
+ * @brief  Adds bytes 0 and 2 of op2, zero-extended, to the halfwords of op1
+ *         (UXTAB16), each halfword wrapping around
+ */
+static inline uint32_t __UXTAB16(uint32_t op1, uint32_t op2)
+{
+  const uint32_t lo = (op1 + (op2 & 0xffu)) & 0xffffu;
+  const uint32_t hi = ((op1 >> 16) + ((op2 >> 16) & 0xffu)) & 0xffffu;
+
+  return (hi << 16) | lo;
+}
+
+/**
+ * @brief  Dual signed 16-bit multiply with 32-bit accumulate (SMLAD), the sum
+ *         wrapping around
+ */
+static inline uint32_t __SMLAD(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+  const int32_t lo = (int32_t) (int16_t) op1 * (int16_t) op2;
+  const int32_t hi = (int32_t) (int16_t) (op1 >> 16) * (int16_t) (op2 >> 16);
+
+  return (uint32_t) lo + (uint32_t) hi + op3;
+}
+
+/* Pack halfwords: bottom of op1 with top of op2 shifted left (PKHBT), top of
+ * op1 with bottom of op2 shifted right (PKHTB), as in cmsis_gcc.h */
+#define __PKHBT(ARG1, ARG2, ARG3) \
+  ((((uint32_t) (ARG1)) & 0x0000ffffu) | ((((uint32_t) (ARG2)) << (ARG3)) & 0xffff0000u))
+#define __PKHTB(ARG1, ARG2, ARG3) \
+  ((((uint32_t) (ARG1)) & 0xffff0000u) | ((((uint32_t) (ARG2)) >> (ARG3)) & 0x0000ffffu))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32H7XX_HAL_STUB_H */
@@ -0,0 +1,10 @@
+/*******************************************************************************
+ * @file           : stm32h7xx_hal_dma2d.h
+ * @brief          : Host stub of the STM32H7 HAL DMA2D driver: empty, the
+ *                   host has no DMA2D.
+ ******************************************************************************/
+
+#ifndef STM32H7XX_HAL_DMA2D_STUB_H
+#define STM32H7XX_HAL_DMA2D_STUB_H
+
+#endif /* STM32H7XX_HAL_DMA2D_STUB_H */
@@ -11,11 +11,16 @@
 
 /* #include "stm32h7xx.h" */
 /* #include "stm32h7xx_dma2d.h" */
+#if defined(STM32L4R9xx)
+#include "stm32l4xx_hal.h"
+#include "stm32l4xx_hal_dma2d.h"
+#else
 #include "stm32h7xx.h"
 #include "stm32h7xx_hal.h"
 #include "stm32h7xx_hal_dma2d.h"
+#endif
 
-#define REPLACE_ALPHA_VALUE (0xF1)
+#define REPLACE_ALPHA_VALUE (0xFF)
 
 typedef struct
 {
@@ -64,8 +69,8 @@ void D2D_DMA2D_IRQHandler(void);
 /* resize setup */
 D2D_Stage_Typedef D2D_Resize_Setup(RESIZE_InitTypedef* R);
 
-/* resize callback */
-__weak void D2D_Resize_Callback(D2D_Stage_Typedef D2D_Stage);
+/* resize callback (weak, to be overridden) */
+void D2D_Resize_Callback(D2D_Stage_Typedef D2D_Stage);
 
 /* resize stage inquire */
 D2D_Stage_Typedef D2D_Resize_Stage(void);
@@ -1,4 +1,5 @@
 #ifndef RGB565TOGRAYSCALE_H
+#define RGB565TOGRAYSCALE_H
 
 #ifdef __cplusplus
 extern "C" {
@@ -51,18 +51,103 @@ typedef enum
 {
   NEAREST,  /*!< Nearest-neighbor interpolation */
   BILINEAR, /*!< Linear interpolation           */
-  BICUBIC   /*!< Cubic interpolation            */
+  BICUBIC,  /*!< Cubic interpolation            */
+  AREA      /*!< Area averaging (box filter)    */
 } intrpl_t;
 
+/**
+ * @brief Image resize backend
+ */
+typedef enum
+{
+  IMG_BACKEND_CPU,  /*!< Software resize                */
+  IMG_BACKEND_DMA2D /*!< DMA2D resize (D2D_resize.c)    */
+} imgbackend_t;
+
+/**
+ * @brief Asynchronous resize completion callback
+ */
+typedef void (*ImgResizeCallback_t)(imgstatus_t status, void *pContext);
+
+/**
+ * @brief Smallest destination (in pixels) resized by the DMA2D when the backend
+ *        is chosen by ImgResizeSelectBackend(), and largest DMA2D source size
+ *        (Q21 blend positions)
+ */
+#ifndef IMG_DMA2D_RESIZE_MIN_PIXELS
+#define IMG_DMA2D_RESIZE_MIN_PIXELS (64 * 64)
+#endif /* IMG_DMA2D_RESIZE_MIN_PIXELS */
+#define IMG_DMA2D_RESIZE_MAX_SIZE   2048
+
+/**
+ * @brief Size in bytes of the workspace of ImgResize() and ImgResizeCrop(),
+ *        holding the tables of their last geometry: larger destinations (see
+ *        ImgResizeWsSize()) are not resized
+ */
+#ifndef IMG_RESIZE_WS_SIZE
+#define IMG_RESIZE_WS_SIZE (32 * 1024)
+#endif /* IMG_RESIZE_WS_SIZE */
+
+/**
+ * @brief RGB565 to grayscale conversion strategy
+ */
+typedef enum
+{
+  GRAY_ARITH,    /*!< Per-pixel multiply-accumulate                        */
+  GRAY_LUT,      /*!< 64 KB table indexed by the pixel (USE_IMG_GRAY_LUT)  */
+  GRAY_LUT_SPLIT /*!< 2x256 partial-sum tables indexed by the pixel bytes  */
+} graystrat_t;
+
+/**
+ * @brief 256-entry ARGB8888 palettes for GRAY8 images (DMA2D L8 CLUT)
+ */
+typedef enum
+{
+  IMG_PALETTE_GRAY,       /*!< Identity: gray level v is color (v, v, v)  */
+  IMG_PALETTE_FALSE_COLOR /*!< Blue to red "jet" map                      */
+} imgpalette_t;
+
+/**
+ * @brief Neural network input tensor element type
+ */
+typedef enum
+{
+  TENSOR_FLOAT32, /*!< Normalized 32-bit float        */
+  TENSOR_INT8,    /*!< Quantized signed 8-bit         */
+  TENSOR_UINT8    /*!< Quantized unsigned 8-bit       */
+} tensortype_t;
+
+/**
+ * @brief Neural network input tensor memory layout
+ */
+typedef enum
+{
+  TENSOR_HWC, /*!< Interleaved channels (height, width, channel) */
+  TENSOR_CHW  /*!< Planar channels (channel, height, width)      */
+} tensorlayout_t;
+
+/**
+ * @brief Neural network input tensor channel order
+ */
+typedef enum
+{
+  TENSOR_RGB, /*!< Red first  */
+  TENSOR_BGR  /*!< Blue first */
+} tensororder_t;
+
 /**
  * @brief Instance structure for images.
+ *        A stride larger than width * bytes per pixel makes the image a view
+ *        on a larger buffer (see ImgCropView()). Leaving it to 0, as zero
+ *        initialization does, describes a packed image.
  */
 typedef struct
 {
-  uint32_t width;  /*!< Image width         */
-  uint32_t height; /*!< Image height        */
-  void *pData;     /*!< Image data buffer   */
-  pxfmt_t format;  /*!< Image pixel format  */
+  uint32_t width;  /*!< Image width                        */
+  uint32_t height; /*!< Image height                       */
+  void *pData;     /*!< Image data buffer (first pixel)    */
+  pxfmt_t format;  /*!< Image pixel format                 */
+  uint32_t stride; /*!< Line pitch in bytes, 0 if packed   */
 } Image_t;
 
 /**
@@ -77,12 +162,98 @@ typedef struct
 } ImgRect_t;
 
 
+/**
+ * @brief Packed SIMD kernels selection. Enabled by default on cores
+ *        implementing the DSP extension (e.g. Cortex-M7), can be forced to 0
+ *        to build the portable C kernels only.
+ */
+#ifndef IMG_USE_SIMD
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define IMG_USE_SIMD 1
+#else
+#define IMG_USE_SIMD 0
+#endif
+#endif /* IMG_USE_SIMD */
+
+/**
+ * @brief Default RGB565 to grayscale strategy, can be changed at runtime with
+ *        ImgSetGrayscaleStrategy().
+ *        The full table lives wherever IMG_GRAY_LUT_SECTION places it (internal
+ *        flash by default) and the split tables (2 KB) wherever
+ *        IMG_GRAY_SPLIT_LUT_SECTION places them (e.g. ".dtcm").
+ */
+#ifndef IMG_GRAY_STRATEGY
+#define IMG_GRAY_STRATEGY GRAY_ARITH
+#endif /* IMG_GRAY_STRATEGY */
+
+/**
+ * @brief The benchmark build (IMG_BENCH) links the full grayscale table in,
+ *        so that every grayscale strategy is measured.
+ */
+#if defined(IMG_BENCH) && (IMG_BENCH != 0) && !defined(USE_IMG_GRAY_LUT)
+#define USE_IMG_GRAY_LUT 1
+#endif
+
 #define IMG_BYTES_PER_PX(pxfmt)  (    \
 ((pxfmt) == PXFMT_GRAY8) ? 1 :        \
 ((pxfmt) == PXFMT_RGB565) ? 2 :       \
 ((pxfmt) == PXFMT_RGB888) ? 3 :       \
 ((pxfmt) == PXFMT_ARGB8888) ? 4 : 0)
 
+/**
+ * @brief Resize workspace: caller-provided memory holding the coordinate and
+ *        weight tables of a resize geometry (source, ROI, destination). The
+ *        tables are only rebuilt when the geometry changes.
+ */
+typedef struct
+{
+  void *pBuffer;         /*!< Tables memory, 4-byte aligned                 */
+  uint32_t size;         /*!< Size of pBuffer in bytes                      */
+  uint32_t geometry[11]; /*!< Geometry of the current tables (private)      */
+} ImgResizeWs_t;
+
+/**
+ * @brief Neural network input tensor description. Each 8-bit source component
+ *        v of channel c (always given in R, G, B order) becomes
+ *        (v - mean[c]) * scale[c], then for quantized tensors
+ *        round(x / qScale) + qZeroPoint, saturated to the element type.
+ */
+typedef struct
+{
+  tensortype_t type;     /*!< Element type                              */
+  tensorlayout_t layout; /*!< Memory layout                             */
+  tensororder_t order;   /*!< Channel order                             */
+  uint32_t width;        /*!< Tensor width                              */
+  uint32_t height;       /*!< Tensor height                             */
+  float mean[3];         /*!< Per-channel mean (R, G, B)                */
+  float scale[3];        /*!< Per-channel scale (R, G, B)               */
+  float qScale;          /*!< Quantization scale (INT8 and UINT8 only)  */
+  int32_t qZeroPoint;    /*!< Quantization zero point (INT8/UINT8 only) */
+} ImgTensorParams_t;
+
+/**
+ * @brief Neural network input tensor instance: parameters and per-channel
+ *        tables mapping an 8-bit component to its tensor value (3 KB).
+ *        Initialized by ImgTensorInit().
+ */
+typedef struct
+{
+  ImgTensorParams_t params; /*!< Tensor description                      */
+  union
+  {
+    float f32[3][256];      /*!< TENSOR_FLOAT32 values                   */
+    uint8_t q8[3][256];     /*!< TENSOR_INT8 / TENSOR_UINT8 values       */
+  } lut;                    /*!< Component to tensor value tables        */
+} ImgTensor_t;
+
+/* Line pitch of an image in bytes */
+#define IMG_STRIDE(img)  (((img)->stride != 0) ? (img)->stride : \
+                          (img)->width * IMG_BYTES_PER_PX((img)->format))
+
+/* Whether the lines of an image are contiguous in memory */
+#define IMG_IS_PACKED(img)  (IMG_STRIDE(img) == \
+                             (img)->width * IMG_BYTES_PER_PX((img)->format))
+
 #ifdef USE_IMG_ASSERT
 #define IMG_ASSERT(expr)  \
 ((expr) ? (void)0U : img_assert_failed((char *) __FUNCTION__, (char *)__FILE__, __LINE__))
@@ -93,15 +264,44 @@ void img_assert_failed(char *function, char *file, uint32_t line);
 
 void ImgCrop(Image_t *imgSrc, Image_t *imgDst, ImgRect_t *cropRect);
 void ImgCropCenter(Image_t *imgSrc, Image_t *imgDst);
-void ImgResize(Image_t *imgSrc, Image_t *imgDst, intrpl_t intrpl);
-void ImgResizeCrop(Image_t *imgSrc, Image_t *imgDst, ImgRect_t *roi, intrpl_t intrpl);
+void ImgCropView(Image_t *imgSrc, Image_t *imgView, ImgRect_t *cropRect);
+imgstatus_t ImgResize(Image_t *imgSrc, Image_t *imgDst, intrpl_t intrpl);
+imgstatus_t ImgResizeCrop(Image_t *imgSrc, Image_t *imgDst, ImgRect_t *roi, intrpl_t intrpl);
+uint32_t ImgResizeWsSize(uint32_t dstWidth, uint32_t dstHeight, intrpl_t intrpl);
+void ImgResizeWsInit(ImgResizeWs_t *ws, void *pBuffer, uint32_t size);
+imgstatus_t ImgResizeCropEx(Image_t *imgSrc, Image_t *imgDst, ImgRect_t *roi,
+                            intrpl_t intrpl, ImgResizeWs_t *ws);
+imgbackend_t ImgResizeSelectBackend(Image_t *imgSrc, Image_t *imgDst,
+                                    ImgRect_t *roi, intrpl_t intrpl);
+imgstatus_t ImgResizeCropAsync(Image_t *imgSrc, Image_t *imgDst, ImgRect_t *roi,
+                               intrpl_t intrpl, ImgResizeWs_t *ws,
+                               uint32_t *pWork, ImgResizeCallback_t callback,
+                               void *pContext);
+void ImgTensorInit(ImgTensor_t *tensor, const ImgTensorParams_t *params);
+uint32_t ImgTensorSize(const ImgTensor_t *tensor);
+imgstatus_t ImgResizeCropToTensor(Image_t *imgSrc, ImgRect_t *roi,
+                                  intrpl_t intrpl, ImgTensor_t *tensor,
+                                  void *pOut);
 void ImgToGrayscale(Image_t *imgSrc, Image_t *imgDst);
+void ImgSetGrayscaleStrategy(graystrat_t strategy);
+graystrat_t ImgGetGrayscaleStrategy(void);
 void ImgToRGB565(Image_t *imgSrc, Image_t *imgDst);
 void ImgToRGB888(Image_t *imgSrc, Image_t *imgDst);
 void ImgToARGB8888(Image_t *imgSrc, Image_t *imgDst);
+void ImgToARGB8888Scaled(Image_t *imgSrc, Image_t *imgDst, Image_t *imgGray);
+void ImgPaletteInit(imgpalette_t palette, uint32_t *pClut);
 #if defined (DMA2D)
 void ImgToRGB565_DMA2D(DMA2D_HandleTypeDef *hdma2d, Image_t *imgSrc, Image_t *imgDst);
 void ImgToRGB888_DMA2D(DMA2D_HandleTypeDef *hdma2d, Image_t *imgSrc, Image_t *imgDst);
+void ImgToARGB8888_DMA2D(DMA2D_HandleTypeDef *hdma2d, Image_t *imgSrc, Image_t *imgDst,
+                         const uint32_t *pClut);
+uint32_t ImgResize_DMA2DWorkSize(uint32_t roiWidth, uint32_t dstHeight);
+imgstatus_t ImgResize_DMA2D(Image_t *imgSrc, Image_t *imgDst, ImgRect_t *roi,
+                            uint32_t *pWork, ImgResizeCallback_t callback,
+                            void *pContext);
+int ImgResize_DMA2DBusy(void);
+int ImgResize_DMA2DAvailable(void);
+int ImgResize_DMA2D_IRQHandler(void);
 #endif
 
 #ifdef __cplusplus
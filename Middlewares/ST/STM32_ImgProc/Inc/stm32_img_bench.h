@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * @file           : stm32_img_bench.h
+ * @brief          : Header file for the image processing micro-benchmarks,
+ *                   run on the host or on the target with the same cases and
+ *                   JSON report.
+ ******************************************************************************/
+
+#ifndef IMAGE_BENCH_H
+#define IMAGE_BENCH_H
+
+#include "stm32_img.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Measured runs per case (after one warm-up run). The report gives
+ *        the minimum and the median of the runs.
+ */
+#ifndef IMG_BENCH_REPEAT
+#define IMG_BENCH_REPEAT 5
+#endif /* IMG_BENCH_REPEAT */
+
+/**
+ * @brief Name of the platform in the report
+ */
+#ifndef IMG_BENCH_TARGET
+#if defined(DWT)
+#define IMG_BENCH_TARGET "stm32"
+#else
+#define IMG_BENCH_TARGET "host"
+#endif
+#endif /* IMG_BENCH_TARGET */
+
+/**
+ * @brief Work buffer of the DMA2D resize cases (VGA source width, 480 lines)
+ */
+#if defined(DMA2D)
+#define IMG_BENCH_DMA2D_WORK_SIZE  (640 * 480 * 4)
+#else
+#define IMG_BENCH_DMA2D_WORK_SIZE  0
+#endif /* DMA2D */
+
+/**
+ * @brief Memory needed by ImgBenchRun(): VGA ARGB8888 source and destination,
+ *        resize workspace, tensor tables and DMA2D resize work buffer
+ */
+#define IMG_BENCH_BUFFER_SIZE  (2 * 640 * 480 * 4 + 64 * 1024 + \
+                                sizeof(ImgTensor_t) + IMG_BENCH_DMA2D_WORK_SIZE)
+
+void ImgBenchRun(void *pBuffer, uint32_t size);
+
+/* Time base, provided by the platform (the DWT cycle counter on Cortex-M) */
+void ImgBenchTimerInit(void);
+uint32_t ImgBenchCycles(void);
+uint32_t ImgBenchCyclesHz(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IMAGE_BENCH_H */
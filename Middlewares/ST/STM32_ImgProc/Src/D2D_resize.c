@@ -8,7 +8,10 @@
 */
 
 #include "D2D_resize.h"
-#define CR_MASK     ((uint32_t)0xFFFCE0FC)  /* DMA2D CR Mask */
+
+/* Layer PFC control: alpha replaced (by REPLACE_ALPHA_VALUE for the BG layer,
+   by the blend factor for the FG layer) */
+#define PFCCR_REPLACE_ALPHA (DMA2D_REPLACE_ALPHA << DMA2D_FGPFCCR_AM_Pos)
 
 /* Setup FG/BG address and FGalpha for linear blend, start DMA2D */
 void D2D_Blend_Line(void);
@@ -25,7 +28,7 @@ typedef struct
 }D2D_Loop_Typedef;  
 
 /*Current resize stage*/
-D2D_Stage_Typedef  D2D_Loop_Stage = D2D_STAGE_IDLE;
+volatile D2D_Stage_Typedef  D2D_Loop_Stage = D2D_STAGE_IDLE;
 
 /*First loop parameter*/
 D2D_Loop_Typedef   D2D_First_Loop;
@@ -66,12 +69,12 @@ D2D_Stage_Typedef D2D_Resize_Setup(RESIZE_InitTypedef* R)
   if(D2D_Loop_Stage != D2D_STAGE_IDLE)
     return (D2D_STAGE_SETUP_BUSY);
   
-  /* DMA2D operation mode */ 
-	DMA2D->CR &= (uint32_t)CR_MASK;
-  DMA2D->CR |= DMA2D_M2M_BLEND;
-  
-  /* DMA2D operation mode */ 
-	DMA2D_ITConfig(DMA2D_IT_TC | DMA2D_IT_TE | DMA2D_IT_CE , ENABLE);
+  /* Test for DMA2D used by another transfer */
+  if(DMA2D->CR & DMA2D_CR_START)
+    return (D2D_STAGE_SETUP_BUSY);
+
+  /* DMA2D operation mode and interrupts */ 
+  DMA2D->CR = DMA2D_M2M_BLEND | DMA2D_CR_TCIE | DMA2D_CR_TEIE | DMA2D_CR_CEIE;
     
   /* first loop parameter init */
   PixelBytes                      = BitsPerPixel[R->SourceColorMode]>>3;
@@ -86,9 +89,9 @@ D2D_Stage_Typedef D2D_Resize_Setup(RESIZE_InitTypedef* R)
   D2D_First_Loop.BlendCoeff       = ((R->SourceHeight-1)<<21) / R->OutputHeight;
   D2D_First_Loop.BlendIndex       = D2D_First_Loop.BlendCoeff>>1; 
 
-  DMA2D->FGPFCCR                  = (REPLACE_ALPHA_VALUE<<16) | R->SourceColorMode; 
-  DMA2D->BGPFCCR                  = (REPLACE_ALPHA_VALUE<<16) | R->SourceColorMode | 0xff000000; 
-  DMA2D->OPFCCR                   = DMA2D_ARGB8888;
+  DMA2D->FGPFCCR                  = PFCCR_REPLACE_ALPHA | R->SourceColorMode; 
+  DMA2D->BGPFCCR                  = PFCCR_REPLACE_ALPHA | R->SourceColorMode | (REPLACE_ALPHA_VALUE<<24); 
+  DMA2D->OPFCCR                   = DMA2D_OUTPUT_ARGB8888;
   DMA2D->NLR                      = (1 | (R->SourceWidth<<16));
   DMA2D->OMAR                     = (uint32_t)R->WorkBuffer;
 
@@ -134,17 +137,17 @@ void D2D_Blend_Line(void)
   DMA2D->FGPFCCR &= 0x00ffffff;
   DMA2D->FGPFCCR |= (FGalpha<<24);
   /* restart DMA2D transfer*/
-  DMA2D_StartTransfer();
+  DMA2D->CR |= DMA2D_CR_START;
 }
 
 
-void DMA2D_IRQHandler(void)
+void D2D_DMA2D_IRQHandler(void)
 {
   /* Test on DMA2D Transfer Complete interrupt */
-  if(DMA2D_GetITStatus(DMA2D_IT_TC)) 
+  if(DMA2D->ISR & DMA2D_ISR_TCIF) 
   {
     /* Clear DMA2D Transfer Complete interrupt Flag */
-    DMA2D_ClearITPendingBit(DMA2D_IT_TC);
+    DMA2D->IFCR = DMA2D_IFCR_CTCIF;
     /* Test for loop in progress */
     if (D2D_Loop_Stage != D2D_STAGE_IDLE)
     {
@@ -164,8 +167,8 @@ void DMA2D_IRQHandler(void)
         if(D2D_Loop_Stage == D2D_STAGE_FIRST_LOOP)
         {
           /* setup DMA2D register */
-          DMA2D->FGPFCCR = (REPLACE_ALPHA_VALUE<<16) | CM_ARGB8888;
-          DMA2D->BGPFCCR = (REPLACE_ALPHA_VALUE<<16) | CM_ARGB8888 | 0xff000000;
+          DMA2D->FGPFCCR = PFCCR_REPLACE_ALPHA | DMA2D_INPUT_ARGB8888;
+          DMA2D->BGPFCCR = PFCCR_REPLACE_ALPHA | DMA2D_INPUT_ARGB8888 | (REPLACE_ALPHA_VALUE<<24);
           DMA2D->OPFCCR  = D2D_Misc_Param.OutputColorMode;
           DMA2D->NLR     = (D2D_Misc_Param.OutputHeight | (1<<16));
           DMA2D->OOR     = D2D_Misc_Param.OutputPitch-1;
@@ -180,10 +183,11 @@ void DMA2D_IRQHandler(void)
         }
         else
         {
-          /* else resize complete */
-          D2D_Resize_Callback(D2D_STAGE_DONE);
-          /* reset to idle stage */
+          /* else resize complete: leave the DMA2D interrupts to other users */
+          DMA2D->CR &= ~(DMA2D_CR_TCIE | DMA2D_CR_TEIE | DMA2D_CR_CEIE);
+          /* reset to idle stage (before the callback, which may start another resize) */
           D2D_Loop_Stage = D2D_STAGE_IDLE;
+          D2D_Resize_Callback(D2D_STAGE_DONE);
         }
       }
     }
@@ -194,18 +198,19 @@ void DMA2D_IRQHandler(void)
   }
   else
   {
-    /* Test on DMA2D Transfer Error interrupt */
-    if(DMA2D_GetITStatus(DMA2D_IT_TE))
+    /* Test on DMA2D Transfer or Configuration Error interrupt */
+    if(DMA2D->ISR & (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF))
     {
-      /* Clear DMA2D Transfer Error interrupt Flag */
-      DMA2D_ClearITPendingBit(DMA2D_IT_TE);
+      /* Clear DMA2D Transfer and Configuration Error interrupt Flags */
+      DMA2D->IFCR = DMA2D_IFCR_CTEIF | DMA2D_IFCR_CCEIF;
       /* Test for resize loop in progress */
       if (D2D_Loop_Stage != D2D_STAGE_IDLE)
       { 
-        /* resize error callback */
-        D2D_Resize_Callback(D2D_STAGE_ERROR);
+        DMA2D->CR &= ~(DMA2D_CR_TCIE | DMA2D_CR_TEIE | DMA2D_CR_CEIE);
         /* reset to IDLE stage */        
         D2D_Loop_Stage = D2D_STAGE_IDLE;
+        /* resize error callback */
+        D2D_Resize_Callback(D2D_STAGE_ERROR);
       }
       else
       {
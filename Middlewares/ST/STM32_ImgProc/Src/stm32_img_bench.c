@@ -0,0 +1,729 @@
+/*******************************************************************************
+ * @file           : stm32_img_bench.c
+ * @brief          : Micro-benchmarks of the image processing kernels: every
+ *                   ImgTo*, ImgCrop* and ImgResize* CPU variant at the camera
+ *                   resolutions and at the usual neural network input sizes,
+ *                   and the DMA2D resize against the CPU one, reported as JSON
+ *                   on the standard output.
+ ******************************************************************************/
+
+#include "stm32_img_bench.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#define ARRAY_SIZE(a)  (sizeof(a) / sizeof((a)[0]))
+
+/* Memory of the benchmark, carved out of the caller's buffer */
+typedef struct
+{
+  uint8_t *pSrc;        /* Source image, VGA ARGB8888 at most           */
+  uint8_t *pDst;        /* Destination image, VGA ARGB8888 at most      */
+  ImgResizeWs_t ws;     /* Resize workspace                             */
+  ImgTensor_t *tensor;  /* Tensor instance                              */
+  uint32_t *pWork;      /* DMA2D resize work buffer, NULL if no DMA2D   */
+  uint32_t count;       /* Results printed so far                       */
+} Bench_t;
+
+typedef struct BenchCase BenchCase_t;
+
+/* Benchmark case: kernel, images and parameters of one measurement */
+struct BenchCase
+{
+  const char *kernel;   /* Function name                                */
+  const char *variant;  /* Strategy or layout variant, NULL if none     */
+  Image_t src;
+  Image_t dst;
+  const char *dstName;  /* Destination name, NULL for its pixel format  */
+  ImgRect_t roi;        /* Crop / resize region of interest             */
+  int intrpl;           /* Interpolation, -1 if none                    */
+  uint32_t bytes;       /* Bytes read and written per run               */
+  void (*run)(Bench_t *bench, BenchCase_t *bc);
+};
+
+static const struct
+{
+  const char *name;
+  uint32_t width;
+  uint32_t height;
+} bench_frames[] = {{"QQVGA", 160, 120}, {"QVGA", 320, 240}, {"VGA", 640, 480}};
+
+static const uint32_t bench_nn_sizes[] = {96, 128, 224};
+
+static const pxfmt_t bench_formats[] = {PXFMT_GRAY8, PXFMT_RGB565,
+                                        PXFMT_RGB888, PXFMT_ARGB8888};
+
+static const char *const bench_format_names[] = {"GRAY8", "RGB565", "RGB888",
+                                                 "ARGB8888"};
+
+static const char *const bench_intrpl_names[] = {"NEAREST", "BILINEAR",
+                                                 "BICUBIC", "AREA"};
+
+static void BenchConvertCases(Bench_t *bench);
+static void BenchCropCases(Bench_t *bench);
+static void BenchResizeCases(Bench_t *bench);
+static void BenchBicubicCases(Bench_t *bench);
+static void BenchBackendCases(Bench_t *bench);
+static void BenchTensorCases(Bench_t *bench);
+static void BenchMeasure(Bench_t *bench, BenchCase_t *bc);
+static void BenchImage(Image_t *img, uint8_t *pData, uint32_t width,
+                       uint32_t height, pxfmt_t format);
+static void BenchFill(uint8_t *pData, uint32_t size);
+
+
+/**
+ * @brief  Runs all the benchmark cases and prints the results as one JSON
+ *         object. Each case runs once to warm up the caches and tables, then
+ *         IMG_BENCH_REPEAT times; the minimum and median durations are
+ *         reported, with the time per destination pixel and the bytes read
+ *         and written per cycle.
+ * @param  pBuffer  Benchmark memory, 32-byte aligned
+ * @param  size     Size of pBuffer, IMG_BENCH_BUFFER_SIZE bytes at least
+ * @retval None
+ */
+void ImgBenchRun(void *pBuffer, uint32_t size)
+{
+  const uint32_t image_size = 640 * 480 * 4;
+  const uint32_t ws_size = size - 2 * image_size - sizeof(ImgTensor_t) -
+                           IMG_BENCH_DMA2D_WORK_SIZE - 32;
+  uint8_t *pMem = (uint8_t *) pBuffer;
+  Bench_t bench;
+
+  IMG_ASSERT(size >= IMG_BENCH_BUFFER_SIZE);
+  IMG_ASSERT(((uintptr_t) pBuffer & 0x3u) == 0);
+
+  bench.pSrc = pMem;
+  bench.pDst = pMem + image_size;
+  bench.tensor = (ImgTensor_t *) (pMem + 2 * image_size);
+  ImgResizeWsInit(&bench.ws, pMem + 2 * image_size + sizeof(ImgTensor_t),
+                  ws_size & ~0x3u);
+  /* DMA2D work buffer at the end, 32-byte aligned */
+  bench.pWork = (IMG_BENCH_DMA2D_WORK_SIZE != 0) ?
+                (uint32_t *) ((uintptr_t) (pMem + size - IMG_BENCH_DMA2D_WORK_SIZE) &
+                              ~(uintptr_t) 0x1F) : NULL;
+  bench.count = 0;
+
+  /* Deterministic content, the same on every platform */
+  BenchFill(bench.pSrc, image_size);
+
+  ImgBenchTimerInit();
+  printf("{\"target\": \"%s\", \"kernels\": \"%s\", \"clock_hz\": %lu, "
+         "\"repeat\": %u, \"results\": [", IMG_BENCH_TARGET,
+         IMG_USE_SIMD ? "SIMD" : "C", (unsigned long) ImgBenchCyclesHz(),
+         (unsigned) IMG_BENCH_REPEAT);
+
+  BenchConvertCases(&bench);
+  BenchCropCases(&bench);
+  BenchResizeCases(&bench);
+  BenchBicubicCases(&bench);
+  BenchBackendCases(&bench);
+  BenchTensorCases(&bench);
+
+  printf("\r\n]}\r\n");
+}
+
+/* Kernel wrappers -----------------------------------------------------------*/
+static void BenchToGrayscale(Bench_t *bench, BenchCase_t *bc)
+{
+  ImgToGrayscale(&bc->src, &bc->dst);
+}
+
+static void BenchToRGB565(Bench_t *bench, BenchCase_t *bc)
+{
+  ImgToRGB565(&bc->src, &bc->dst);
+}
+
+static void BenchToRGB888(Bench_t *bench, BenchCase_t *bc)
+{
+  ImgToRGB888(&bc->src, &bc->dst);
+}
+
+static void BenchToARGB8888(Bench_t *bench, BenchCase_t *bc)
+{
+  ImgToARGB8888(&bc->src, &bc->dst);
+}
+
+static void BenchToARGB8888Scaled(Bench_t *bench, BenchCase_t *bc)
+{
+  ImgToARGB8888Scaled(&bc->src, &bc->dst, NULL);
+}
+
+/* Two-pass reference of ImgToARGB8888Scaled(): ImgToGrayscale() to a GRAY8
+ * frame (right after the source frame), then a 2x2 replication of each gray
+ * level as an opaque ARGB8888 pixel */
+static void BenchToARGB8888TwoPass(Bench_t *bench, BenchCase_t *bc)
+{
+  const uint32_t pitch = IMG_STRIDE(&bc->dst) / 4;
+  Image_t gray = {.width = bc->src.width,
+                  .height = bc->src.height,
+                  .pData = (uint8_t *) bc->src.pData +
+                           IMG_STRIDE(&bc->src) * bc->src.height,
+                  .format = PXFMT_GRAY8};
+  const uint8_t *pGray = (const uint8_t *) gray.pData;
+  uint32_t *pOut = (uint32_t *) bc->dst.pData;
+
+  ImgToGrayscale(&bc->src, &gray);
+  for (uint32_t row = 0; row < gray.height; row++)
+  {
+    uint32_t *pOut0 = pOut + 2 * row * pitch;
+    uint32_t *pOut1 = pOut0 + pitch;
+
+    for (uint32_t col = 0; col < gray.width; col++)
+    {
+      const uint32_t argb = 0xFF000000u | (*pGray++ * 0x00010101u);
+
+      *pOut0++ = argb;
+      *pOut0++ = argb;
+      *pOut1++ = argb;
+      *pOut1++ = argb;
+    }
+  }
+}
+
+static void BenchCrop(Bench_t *bench, BenchCase_t *bc)
+{
+  ImgCrop(&bc->src, &bc->dst, &bc->roi);
+}
+
+static void BenchCropCenter(Bench_t *bench, BenchCase_t *bc)
+{
+  ImgCropCenter(&bc->src, &bc->dst);
+}
+
+static void BenchResize(Bench_t *bench, BenchCase_t *bc)
+{
+  ImgResize(&bc->src, &bc->dst, (intrpl_t) bc->intrpl);
+}
+
+static void BenchResizeCrop(Bench_t *bench, BenchCase_t *bc)
+{
+  ImgResizeCrop(&bc->src, &bc->dst, &bc->roi, (intrpl_t) bc->intrpl);
+}
+
+static void BenchResizeCropEx(Bench_t *bench, BenchCase_t *bc)
+{
+  (void) ImgResizeCropEx(&bc->src, &bc->dst, &bc->roi, (intrpl_t) bc->intrpl,
+                         &bench->ws);
+}
+
+#if defined(DMA2D)
+static void BenchResizeDMA2D(Bench_t *bench, BenchCase_t *bc)
+{
+  if (ImgResize_DMA2D(&bc->src, &bc->dst, NULL, bench->pWork, NULL, NULL) == IMG_OK)
+  {
+    while (ImgResize_DMA2DBusy())
+    {
+    }
+  }
+}
+#endif /* DMA2D */
+
+static void BenchResizeCropToTensor(Bench_t *bench, BenchCase_t *bc)
+{
+  (void) ImgResizeCropToTensor(&bc->src, &bc->roi, (intrpl_t) bc->intrpl,
+                               bench->tensor, bc->dst.pData);
+}
+
+/* Cases ---------------------------------------------------------------------*/
+/**
+ * @brief  Color conversions of whole frames, in every supported direction.
+ *         The RGB565 to grayscale conversion is measured with each strategy.
+ *         Each conversion is also measured on views one pixel narrower than
+ *         the frame ("strided" variant): converted line per line, with an odd
+ *         width, so that every line ends with the scalar tail of the SIMD
+ *         kernels. ImgToARGB8888Scaled() doubles the frame, up to QVGA, and
+ *         is compared with the two passes it replaces.
+ * @param  bench  Benchmark instance
+ * @retval None
+ */
+static void BenchConvertCases(Bench_t *bench)
+{
+  static const struct
+  {
+    const char *kernel;
+    pxfmt_t src;
+    pxfmt_t dst;
+    void (*run)(Bench_t *bench, BenchCase_t *bc);
+  } converts[] = {
+    {"ImgToGrayscale", PXFMT_RGB565, PXFMT_GRAY8, BenchToGrayscale},
+    {"ImgToGrayscale", PXFMT_RGB888, PXFMT_GRAY8, BenchToGrayscale},
+    {"ImgToRGB565", PXFMT_RGB888, PXFMT_RGB565, BenchToRGB565},
+    {"ImgToRGB888", PXFMT_RGB565, PXFMT_RGB888, BenchToRGB888},
+    {"ImgToRGB888", PXFMT_GRAY8, PXFMT_RGB888, BenchToRGB888},
+    {"ImgToARGB8888", PXFMT_RGB565, PXFMT_ARGB8888, BenchToARGB8888},
+    {"ImgToARGB8888", PXFMT_GRAY8, PXFMT_ARGB8888, BenchToARGB8888},
+  };
+  static const struct
+  {
+    const char *name;
+    graystrat_t strategy;
+  } strategies[] = {
+    {"GRAY_ARITH", GRAY_ARITH},
+#ifdef USE_IMG_GRAY_LUT
+    {"GRAY_LUT", GRAY_LUT},
+#endif
+    {"GRAY_LUT_SPLIT", GRAY_LUT_SPLIT},
+  };
+  const graystrat_t strategy = ImgGetGrayscaleStrategy();
+  BenchCase_t bc;
+
+  memset(&bc, 0, sizeof(bc));
+  bc.intrpl = -1;
+  for (uint32_t f = 0; f < ARRAY_SIZE(bench_frames); f++)
+  {
+    const uint32_t w = bench_frames[f].width;
+    const uint32_t h = bench_frames[f].height;
+
+    for (uint32_t c = 0; c < ARRAY_SIZE(converts); c++)
+    {
+      const uint32_t src_px = IMG_BYTES_PER_PX(converts[c].src);
+      const uint32_t dst_px = IMG_BYTES_PER_PX(converts[c].dst);
+
+      bc.kernel = converts[c].kernel;
+      bc.run = converts[c].run;
+      BenchImage(&bc.src, bench->pSrc, w, h, converts[c].src);
+      BenchImage(&bc.dst, bench->pDst, w, h, converts[c].dst);
+      bc.bytes = w * h * (src_px + dst_px);
+      if (converts[c].src == PXFMT_RGB565 && converts[c].dst == PXFMT_GRAY8)
+      {
+        for (uint32_t s = 0; s < ARRAY_SIZE(strategies); s++)
+        {
+          bc.variant = strategies[s].name;
+          ImgSetGrayscaleStrategy(strategies[s].strategy);
+          BenchMeasure(bench, &bc);
+        }
+        ImgSetGrayscaleStrategy(strategy);
+      }
+      else
+      {
+        bc.variant = NULL;
+        BenchMeasure(bench, &bc);
+      }
+
+      bc.variant = "strided";
+      BenchImage(&bc.src, bench->pSrc, w - 1, h, converts[c].src);
+      BenchImage(&bc.dst, bench->pDst, w - 1, h, converts[c].dst);
+      bc.src.stride = w * src_px;
+      bc.dst.stride = w * dst_px;
+      bc.bytes = (w - 1) * h * (src_px + dst_px);
+      BenchMeasure(bench, &bc);
+    }
+    bc.variant = NULL;
+
+    if (2 * w <= 640)
+    {
+      /* Fused kernel against ImgToGrayscale() plus a 2x replication pass */
+      bc.kernel = "ImgToARGB8888Scaled";
+      BenchImage(&bc.src, bench->pSrc, w, h, PXFMT_RGB565);
+      BenchImage(&bc.dst, bench->pDst, 2 * w, 2 * h, PXFMT_ARGB8888);
+      bc.variant = "fused";
+      bc.run = BenchToARGB8888Scaled;
+      bc.bytes = w * h * (2 + 4 * 4);
+      BenchMeasure(bench, &bc);
+      bc.variant = "two-pass";
+      bc.run = BenchToARGB8888TwoPass;
+      bc.bytes = w * h * (2 + 1 + 1 + 4 * 4);
+      BenchMeasure(bench, &bc);
+      bc.variant = NULL;
+    }
+  }
+}
+
+/**
+ * @brief  Crops of the network input sizes out of the frames (top-left corner
+ *         and center), in every pixel format. ImgCropView() copies nothing
+ *         and is not measured.
+ * @param  bench  Benchmark instance
+ * @retval None
+ */
+static void BenchCropCases(Bench_t *bench)
+{
+  BenchCase_t bc;
+
+  memset(&bc, 0, sizeof(bc));
+  bc.intrpl = -1;
+  for (uint32_t f = 0; f < ARRAY_SIZE(bench_frames); f++)
+  {
+    const uint32_t w = bench_frames[f].width;
+    const uint32_t h = bench_frames[f].height;
+
+    for (uint32_t n = 0; n < ARRAY_SIZE(bench_nn_sizes); n++)
+    {
+      const uint32_t size = bench_nn_sizes[n];
+
+      if (size > h)
+      {
+        continue;
+      }
+      for (uint32_t p = 0; p < ARRAY_SIZE(bench_formats); p++)
+      {
+        BenchImage(&bc.src, bench->pSrc, w, h, bench_formats[p]);
+        BenchImage(&bc.dst, bench->pDst, size, size, bench_formats[p]);
+        bc.roi = (ImgRect_t) {0, 0, size, size};
+        bc.bytes = 2 * size * size * IMG_BYTES_PER_PX(bench_formats[p]);
+
+        bc.kernel = "ImgCrop";
+        bc.run = BenchCrop;
+        BenchMeasure(bench, &bc);
+
+        bc.kernel = "ImgCropCenter";
+        bc.run = BenchCropCenter;
+        BenchMeasure(bench, &bc);
+      }
+    }
+  }
+}
+
+/**
+ * @brief  Resizes of the frames to the network input sizes, in every pixel
+ *         format and with every interpolation: whole frame (ImgResize()),
+ *         and centered square region of interest (ImgResizeCrop() and
+ *         ImgResizeCropEx(), whose tables are built by the warm-up run).
+ *         ImgResize() and ImgResizeCrop() are skipped when their tables
+ *         exceed IMG_RESIZE_WS_SIZE.
+ * @param  bench  Benchmark instance
+ * @retval None
+ */
+static void BenchResizeCases(Bench_t *bench)
+{
+  BenchCase_t bc;
+
+  memset(&bc, 0, sizeof(bc));
+  for (uint32_t f = 0; f < ARRAY_SIZE(bench_frames); f++)
+  {
+    const uint32_t w = bench_frames[f].width;
+    const uint32_t h = bench_frames[f].height;
+
+    for (uint32_t n = 0; n < ARRAY_SIZE(bench_nn_sizes); n++)
+    {
+      const uint32_t size = bench_nn_sizes[n];
+
+      for (uint32_t p = 0; p < ARRAY_SIZE(bench_formats); p++)
+      {
+        const uint32_t pixel_size = IMG_BYTES_PER_PX(bench_formats[p]);
+
+        BenchImage(&bc.src, bench->pSrc, w, h, bench_formats[p]);
+        BenchImage(&bc.dst, bench->pDst, size, size, bench_formats[p]);
+        for (int i = NEAREST; i <= AREA; i++)
+        {
+          bc.intrpl = i;
+
+          const uint8_t fits = (ImgResizeWsSize(size, size, (intrpl_t) i) <=
+                                IMG_RESIZE_WS_SIZE);
+
+          if (fits)
+          {
+            bc.kernel = "ImgResize";
+            bc.run = BenchResize;
+            bc.roi = (ImgRect_t) {0, 0, w, h};
+            bc.bytes = (w * h + size * size) * pixel_size;
+            BenchMeasure(bench, &bc);
+          }
+
+          bc.roi = (ImgRect_t) {(w - h) / 2, 0, h, h};
+          bc.bytes = (h * h + size * size) * pixel_size;
+
+          if (fits)
+          {
+            bc.kernel = "ImgResizeCrop";
+            bc.run = BenchResizeCrop;
+            BenchMeasure(bench, &bc);
+          }
+
+          if (bench->ws.size >= ImgResizeWsSize(size, size, (intrpl_t) i))
+          {
+            bc.kernel = "ImgResizeCropEx";
+            bc.run = BenchResizeCropEx;
+            BenchMeasure(bench, &bc);
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief  BICUBIC resizes of the QVGA frame over a range of destination sizes,
+ *         from 4x down to 2x up, with the workspace tables and line ring
+ *         (ImgResizeCropEx()), to show how the cost per destination pixel
+ *         scales with the ratio.
+ * @param  bench  Benchmark instance
+ * @retval None
+ */
+static void BenchBicubicCases(Bench_t *bench)
+{
+  static const uint32_t sizes[][2] = {{80, 60}, {160, 120}, {240, 180},
+                                      {320, 240}, {480, 360}, {640, 480}};
+  static const pxfmt_t formats[] = {PXFMT_RGB565, PXFMT_RGB888};
+  const uint32_t w = 320;
+  const uint32_t h = 240;
+  BenchCase_t bc;
+
+  memset(&bc, 0, sizeof(bc));
+  bc.intrpl = BICUBIC;
+  bc.variant = "sweep";
+  bc.roi = (ImgRect_t) {0, 0, w, h};
+  for (uint32_t p = 0; p < ARRAY_SIZE(formats); p++)
+  {
+    const uint32_t pixel_size = IMG_BYTES_PER_PX(formats[p]);
+
+    for (uint32_t n = 0; n < ARRAY_SIZE(sizes); n++)
+    {
+      BenchImage(&bc.src, bench->pSrc, w, h, formats[p]);
+      BenchImage(&bc.dst, bench->pDst, sizes[n][0], sizes[n][1], formats[p]);
+      bc.bytes = (w * h + sizes[n][0] * sizes[n][1]) * pixel_size;
+
+      if (bench->ws.size >= ImgResizeWsSize(sizes[n][0], sizes[n][1], BICUBIC))
+      {
+        bc.kernel = "ImgResizeCropEx";
+        bc.run = BenchResizeCropEx;
+        BenchMeasure(bench, &bc);
+      }
+    }
+  }
+}
+
+/**
+ * @brief  Bilinear RGB565 resizes on each backend, at the sizes of the camera
+ *         pipeline: QVGA frame to network input, VGA frame to LCD. The DMA2D
+ *         runs until its completion interrupt, with the source cleaned from
+ *         the D-Cache beforehand.
+ * @param  bench  Benchmark instance
+ * @retval None
+ */
+static void BenchBackendCases(Bench_t *bench)
+{
+  static const struct
+  {
+    uint32_t srcW;
+    uint32_t srcH;
+    uint32_t dstW;
+    uint32_t dstH;
+  } sizes[] = {{320, 240, 224, 224}, {640, 480, 800, 480}};
+  BenchCase_t bc;
+
+  memset(&bc, 0, sizeof(bc));
+  bc.kernel = "ImgResize";
+  bc.intrpl = BILINEAR;
+  for (uint32_t i = 0; i < ARRAY_SIZE(sizes); i++)
+  {
+    BenchImage(&bc.src, bench->pSrc, sizes[i].srcW, sizes[i].srcH, PXFMT_RGB565);
+    BenchImage(&bc.dst, bench->pDst, sizes[i].dstW, sizes[i].dstH, PXFMT_RGB565);
+    bc.bytes = (sizes[i].srcW * sizes[i].srcH + sizes[i].dstW * sizes[i].dstH) * 2;
+
+    bc.variant = "CPU";
+    bc.run = BenchResize;
+    BenchMeasure(bench, &bc);
+
+#if defined(DMA2D)
+    if ((bench->pWork != NULL) &&
+        (ImgResize_DMA2DWorkSize(sizes[i].srcW, sizes[i].dstH) <= IMG_BENCH_DMA2D_WORK_SIZE))
+    {
+      SCB_CleanInvalidateDCache();
+      bc.variant = "DMA2D";
+      bc.run = BenchResizeDMA2D;
+      BenchMeasure(bench, &bc);
+    }
+#endif /* DMA2D */
+  }
+}
+
+/**
+ * @brief  Network input tensors (HWC, RGB) built from the centered square
+ *         region of interest of RGB565 frames, for a float and a quantized
+ *         element type.
+ * @param  bench  Benchmark instance
+ * @retval None
+ */
+static void BenchTensorCases(Bench_t *bench)
+{
+  static const struct
+  {
+    const char *name;
+    tensortype_t type;
+    uint32_t elemSize;
+  } types[] = {{"TENSOR_UINT8", TENSOR_UINT8, 1},
+               {"TENSOR_FLOAT32", TENSOR_FLOAT32, 4}};
+  ImgTensorParams_t params = {
+    .layout = TENSOR_HWC,
+    .order = TENSOR_RGB,
+    .mean = {127.5f, 127.5f, 127.5f},
+    .scale = {1.0f / 127.5f, 1.0f / 127.5f, 1.0f / 127.5f},
+    .qScale = 1.0f / 127.5f,
+    .qZeroPoint = 128,
+  };
+  BenchCase_t bc;
+
+  memset(&bc, 0, sizeof(bc));
+  bc.kernel = "ImgResizeCropToTensor";
+  bc.run = BenchResizeCropToTensor;
+  for (uint32_t t = 0; t < ARRAY_SIZE(types); t++)
+  {
+    bc.dstName = types[t].name;
+    for (uint32_t n = 0; n < ARRAY_SIZE(bench_nn_sizes); n++)
+    {
+      const uint32_t size = bench_nn_sizes[n];
+
+      params.type = types[t].type;
+      params.width = size;
+      params.height = size;
+      ImgTensorInit(bench->tensor, &params);
+
+      for (uint32_t f = 0; f < ARRAY_SIZE(bench_frames); f++)
+      {
+        const uint32_t w = bench_frames[f].width;
+        const uint32_t h = bench_frames[f].height;
+
+        BenchImage(&bc.src, bench->pSrc, w, h, PXFMT_RGB565);
+        /* Dimensions of the tensor, its name for the format */
+        BenchImage(&bc.dst, bench->pDst, size, size, PXFMT_RGB888);
+        bc.roi = (ImgRect_t) {(w - h) / 2, 0, h, h};
+        bc.bytes = h * h * 2 + size * size * 3 * types[t].elemSize;
+        for (int i = NEAREST; i <= BILINEAR; i++)
+        {
+          bc.intrpl = i;
+          BenchMeasure(bench, &bc);
+        }
+      }
+    }
+  }
+}
+
+/* Measurement ---------------------------------------------------------------*/
+/**
+ * @brief  Measures a case and prints its result as a JSON object.
+ * @param  bench  Benchmark instance
+ * @param  bc     Case to measure
+ * @retval None
+ */
+static void BenchMeasure(Bench_t *bench, BenchCase_t *bc)
+{
+  uint32_t cycles[IMG_BENCH_REPEAT];
+  const double hz = (double) ImgBenchCyclesHz();
+  const uint32_t pixels = bc->dst.width * bc->dst.height;
+
+  bc->run(bench, bc);
+
+  for (uint32_t i = 0; i < IMG_BENCH_REPEAT; i++)
+  {
+    const uint32_t start = ImgBenchCycles();
+
+    bc->run(bench, bc);
+    cycles[i] = ImgBenchCycles() - start;
+  }
+
+  /* Insertion sort, for the median */
+  for (uint32_t i = 1; i < IMG_BENCH_REPEAT; i++)
+  {
+    const uint32_t c = cycles[i];
+    uint32_t j = i;
+
+    for (; (j > 0) && (cycles[j - 1] > c); j--)
+    {
+      cycles[j] = cycles[j - 1];
+    }
+    cycles[j] = c;
+  }
+
+  const uint32_t best = (cycles[0] != 0) ? cycles[0] : 1;
+  const double ns = (double) best * 1e9 / hz;
+
+  printf("%s\r\n  {\"kernel\": \"%s\", ", (bench->count++ != 0) ? "," : "",
+         bc->kernel);
+  if (bc->variant != NULL)
+  {
+    printf("\"variant\": \"%s\", ", bc->variant);
+  }
+  printf("\"src\": \"%s\", \"src_w\": %lu, \"src_h\": %lu, ",
+         bench_format_names[bc->src.format], (unsigned long) bc->src.width,
+         (unsigned long) bc->src.height);
+  printf("\"dst\": \"%s\", \"dst_w\": %lu, \"dst_h\": %lu, ",
+         (bc->dstName != NULL) ? bc->dstName :
+         bench_format_names[bc->dst.format], (unsigned long) bc->dst.width,
+         (unsigned long) bc->dst.height);
+  if (bc->intrpl >= 0)
+  {
+    printf("\"intrpl\": \"%s\", ", bench_intrpl_names[bc->intrpl]);
+  }
+  printf("\"bytes\": %lu, \"cycles_min\": %lu, \"cycles_med\": %lu, "
+         "\"ns\": %.0f, \"ns_per_px\": %.3f, \"bytes_per_cycle\": %.3f}",
+         (unsigned long) bc->bytes, (unsigned long) cycles[0],
+         (unsigned long) cycles[IMG_BENCH_REPEAT / 2], ns, ns / pixels,
+         (double) bc->bytes / best);
+}
+
+/**
+ * @brief  Describes a packed image.
+ * @param  img     Image to fill in
+ * @param  pData   Image data
+ * @param  width   Image width
+ * @param  height  Image height
+ * @param  format  Pixel format
+ * @retval None
+ */
+static void BenchImage(Image_t *img, uint8_t *pData, uint32_t width,
+                       uint32_t height, pxfmt_t format)
+{
+  img->width = width;
+  img->height = height;
+  img->pData = pData;
+  img->format = format;
+  img->stride = 0;
+}
+
+/**
+ * @brief  Fills a buffer with pseudo-random bytes (fixed seed LCG).
+ * @param  pData  Buffer
+ * @param  size   Buffer size in bytes
+ * @retval None
+ */
+static void BenchFill(uint8_t *pData, uint32_t size)
+{
+  uint32_t state = 0x12345678u;
+
+  for (uint32_t i = 0; i < size; i++)
+  {
+    state = state * 1664525u + 1013904223u;
+    pData[i] = (uint8_t) (state >> 24);
+  }
+}
+
+#if defined(DWT)
+/* Cortex-M time base: the DWT cycle counter */
+
+/**
+ * @brief  Starts the DWT cycle counter, if not running yet.
+ * @retval None
+ */
+void ImgBenchTimerInit(void)
+{
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0)
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7)
+    /* Cortex-M7 DWT software lock */
+    DWT->LAR = 0xC5ACCE55;
+#endif
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+}
+
+/**
+ * @brief  Returns the cycle counter.
+ * @retval Core clock cycles, wrapping around
+ */
+uint32_t ImgBenchCycles(void)
+{
+  return DWT->CYCCNT;
+}
+
+/**
+ * @brief  Returns the cycle counter frequency.
+ * @retval Core clock frequency in Hz
+ */
+uint32_t ImgBenchCyclesHz(void)
+{
+  return SystemCoreClock;
+}
+#endif /* DWT */
@@ -6,8 +6,22 @@
 
 #include "stm32_img.h"
 #include <stddef.h>
+#if defined(USE_IMG_GRAY_LUT)
+#include "rgb565tograyscale_lut.h"
+#endif
 
 static void rgb565_to_gray8(uint16_t *pIn, uint8_t *pOut, uint32_t num_pixels);
+#if defined(USE_IMG_GRAY_LUT)
+static void rgb565_to_gray8_lut(uint16_t *pIn, uint8_t *pOut,
+                                uint32_t num_pixels);
+#endif
+static void rgb565_to_gray8_lut_split(uint16_t *pIn, uint8_t *pOut,
+                                      uint32_t num_pixels);
+static void gray_lut_split_init(void);
+static void rgb565_to_gray_argb8888_x2(uint16_t *pIn, uint32_t in_pitch,
+                                       uint32_t width, uint32_t height,
+                                       uint32_t *pOut, uint32_t out_pitch,
+                                       uint8_t *pGray, uint32_t gray_pitch);
 static void rgb565_to_rgb888(uint16_t *pIn, uint8_t *pOut, uint32_t num_pixels);
 static void rgb565_to_argb8888(uint16_t *pIn, uint8_t *pOut,
                                uint32_t num_pixels);
@@ -16,6 +30,56 @@ static void rgb888_to_gray8(uint8_t *pIn, uint8_t *pOut, uint32_t num_pixels);
 static void gray8_to_rgb888(uint8_t *pIn, uint8_t *pOut, uint32_t num_pixels);
 static void gray8_to_argb8888(uint8_t *pIn, uint8_t *pOut, uint32_t num_pixels);
 
+/* RGB565 to grayscale strategy used by ImgToGrayscale() */
+static graystrat_t gray_strategy = IMG_GRAY_STRATEGY;
+
+/* Partial sums of the grayscale formula for each byte of a RGB565 pixel:
+ * [0] indexed by the high byte (R:5 and G[5:3], rounding term included),
+ * [1] indexed by the low byte (G[2:0] and B:5). */
+#if defined(IMG_GRAY_SPLIT_LUT_SECTION)
+__attribute__((section(IMG_GRAY_SPLIT_LUT_SECTION)))
+#endif
+static uint32_t gray_lut_split[2][256];
+static uint8_t gray_lut_split_ready = 0;
+
+void ImgSetGrayscaleStrategy(graystrat_t strategy)
+{
+#if !defined(USE_IMG_GRAY_LUT)
+  IMG_ASSERT(strategy != GRAY_LUT); /* Table not linked in */
+#endif
+  if (strategy == GRAY_LUT_SPLIT)
+    {
+      /* Build the tables now rather than within the first conversion */
+      gray_lut_split_init();
+    }
+  gray_strategy = strategy;
+}
+
+graystrat_t ImgGetGrayscaleStrategy(void)
+{
+  return gray_strategy;
+}
+
+/**
+ * @brief  Gets how a conversion walks the images: line per line, or the whole
+ *         image as a single line when both images are packed.
+ * @param  imgSrc     Source image
+ * @param  imgDst     Destination image
+ * @param  num_pixels Number of pixels per line
+ * @retval Number of lines
+ */
+static uint32_t cvt_lines(Image_t *imgSrc, Image_t *imgDst,
+                          uint32_t *num_pixels)
+{
+  if (IMG_IS_PACKED(imgSrc) && IMG_IS_PACKED(imgDst))
+    {
+      *num_pixels = imgSrc->width * imgSrc->height;
+      return 1;
+    }
+  *num_pixels = imgSrc->width;
+  return imgSrc->height;
+}
+
 void ImgToGrayscale(Image_t *imgSrc, Image_t *imgDst)
 {
   IMG_ASSERT(imgSrc->format == PXFMT_RGB565 || imgSrc->format == PXFMT_RGB888);
@@ -25,22 +89,47 @@ void ImgToGrayscale(Image_t *imgSrc, Image_t *imgDst)
   IMG_ASSERT(imgDst->pData != NULL);
   IMG_ASSERT(imgDst->format == PXFMT_GRAY8);
 
-  const uint32_t width = imgSrc->width;
-  const uint32_t height = imgSrc->height;
-  const uint32_t num_pixels = width * height;
+  uint32_t num_pixels;
+  const uint32_t num_lines = cvt_lines(imgSrc, imgDst, &num_pixels);
+  const uint32_t src_stride = IMG_STRIDE(imgSrc);
+  const uint32_t dst_stride = IMG_STRIDE(imgDst);
+  uint8_t *pIn = (uint8_t *) imgSrc->pData;
+  uint8_t *pOut = (uint8_t *) imgDst->pData;
 
-  switch (imgSrc->format)
+  /* Line per line, unless both images are packed */
+  for (uint32_t i = 0; i < num_lines; i++)
     {
-    case PXFMT_RGB565:
-      rgb565_to_gray8(imgSrc->pData, imgDst->pData, num_pixels);
-      break;
-
-    case PXFMT_RGB888:
-      rgb888_to_gray8(imgSrc->pData, imgDst->pData, num_pixels);
-      break;
-
-    default:
-      break;
+      switch (imgSrc->format)
+        {
+        case PXFMT_RGB565:
+          switch (gray_strategy)
+            {
+#if defined(USE_IMG_GRAY_LUT)
+            case GRAY_LUT:
+              rgb565_to_gray8_lut((void *) pIn, (void *) pOut, num_pixels);
+              break;
+#endif
+            case GRAY_LUT_SPLIT:
+              gray_lut_split_init();
+              rgb565_to_gray8_lut_split((void *) pIn, (void *) pOut,
+                                        num_pixels);
+              break;
+
+            default:
+              rgb565_to_gray8((void *) pIn, (void *) pOut, num_pixels);
+              break;
+            }
+          break;
+
+        case PXFMT_RGB888:
+          rgb888_to_gray8((void *) pIn, (void *) pOut, num_pixels);
+          break;
+
+        default:
+          break;
+        }
+      pIn += src_stride;
+      pOut += dst_stride;
     }
 }
 
@@ -53,19 +142,28 @@ void ImgToRGB565(Image_t *imgSrc, Image_t *imgDst)
   IMG_ASSERT(imgDst->pData != NULL);
   IMG_ASSERT(imgDst->format == PXFMT_RGB565);
 
-  const uint32_t width = imgSrc->width;
-  const uint32_t height = imgSrc->height;
-  const uint32_t num_pixels = width * height;
-
-  switch (imgSrc->format)
-  {
-  case PXFMT_RGB888:
-    rgb888_to_rgb565(imgSrc->pData, imgDst->pData, num_pixels);
-    break;
+  uint32_t num_pixels;
+  const uint32_t num_lines = cvt_lines(imgSrc, imgDst, &num_pixels);
+  const uint32_t src_stride = IMG_STRIDE(imgSrc);
+  const uint32_t dst_stride = IMG_STRIDE(imgDst);
+  uint8_t *pIn = (uint8_t *) imgSrc->pData;
+  uint8_t *pOut = (uint8_t *) imgDst->pData;
 
-  default:
-    break;
-  }
+  /* Line per line, unless both images are packed */
+  for (uint32_t i = 0; i < num_lines; i++)
+    {
+      switch (imgSrc->format)
+      {
+      case PXFMT_RGB888:
+        rgb888_to_rgb565((void *) pIn, (void *) pOut, num_pixels);
+        break;
+
+      default:
+        break;
+      }
+      pIn += src_stride;
+      pOut += dst_stride;
+    }
 }
 
 void ImgToRGB888(Image_t *imgSrc, Image_t *imgDst)
@@ -77,22 +175,31 @@ void ImgToRGB888(Image_t *imgSrc, Image_t *imgDst)
   IMG_ASSERT(imgDst->pData != NULL);
   IMG_ASSERT(imgDst->format == PXFMT_RGB888);
 
-  const uint32_t width = imgSrc->width;
-  const uint32_t height = imgSrc->height;
-  const uint32_t num_pixels = width * height;
+  uint32_t num_pixels;
+  const uint32_t num_lines = cvt_lines(imgSrc, imgDst, &num_pixels);
+  const uint32_t src_stride = IMG_STRIDE(imgSrc);
+  const uint32_t dst_stride = IMG_STRIDE(imgDst);
+  uint8_t *pIn = (uint8_t *) imgSrc->pData;
+  uint8_t *pOut = (uint8_t *) imgDst->pData;
 
-  switch (imgSrc->format)
+  /* Line per line, unless both images are packed */
+  for (uint32_t i = 0; i < num_lines; i++)
     {
-    case PXFMT_GRAY8:
-      gray8_to_rgb888(imgSrc->pData, imgDst->pData, num_pixels);
-      break;
+      switch (imgSrc->format)
+        {
+        case PXFMT_GRAY8:
+          gray8_to_rgb888((void *) pIn, (void *) pOut, num_pixels);
+          break;
 
-    case PXFMT_RGB565:
-      rgb565_to_rgb888(imgSrc->pData, imgDst->pData, num_pixels);
-      break;
+        case PXFMT_RGB565:
+          rgb565_to_rgb888((void *) pIn, (void *) pOut, num_pixels);
+          break;
 
-    default:
-      break;
+        default:
+          break;
+        }
+      pIn += src_stride;
+      pOut += dst_stride;
     }
 }
 
@@ -103,24 +210,104 @@ void ImgToARGB8888(Image_t *imgSrc, Image_t *imgDst)
   IMG_ASSERT(imgSrc->width == imgDst->width);
   IMG_ASSERT(imgSrc->height == imgDst->height);
   IMG_ASSERT(imgDst->pData != NULL);
-  IMG_ASSERT(imgDst->format == PXFMT_RGB888);
+  IMG_ASSERT(imgDst->format == PXFMT_ARGB8888);
 
-  const uint32_t width = imgSrc->width;
-  const uint32_t height = imgSrc->height;
-  const uint32_t num_pixels = width * height;
+  uint32_t num_pixels;
+  const uint32_t num_lines = cvt_lines(imgSrc, imgDst, &num_pixels);
+  const uint32_t src_stride = IMG_STRIDE(imgSrc);
+  const uint32_t dst_stride = IMG_STRIDE(imgDst);
+  uint8_t *pIn = (uint8_t *) imgSrc->pData;
+  uint8_t *pOut = (uint8_t *) imgDst->pData;
 
-  switch (imgSrc->format)
+  /* Line per line, unless both images are packed */
+  for (uint32_t i = 0; i < num_lines; i++)
     {
-    case PXFMT_GRAY8:
-      gray8_to_argb8888(imgSrc->pData, imgDst->pData, num_pixels);
-      break;
+      switch (imgSrc->format)
+        {
+        case PXFMT_GRAY8:
+          gray8_to_argb8888((void *) pIn, (void *) pOut, num_pixels);
+          break;
+
+        case PXFMT_RGB565:
+          rgb565_to_argb8888((void *) pIn, (void *) pOut, num_pixels);
+          break;
+
+        default:
+          break;
+        }
+      pIn += src_stride;
+      pOut += dst_stride;
+    }
+}
 
-    case PXFMT_RGB565:
-      rgb565_to_argb8888(imgSrc->pData, imgDst->pData, num_pixels);
-      break;
+/**
+ * @brief  Converts a RGB565 image to grayscale and writes it 2x upscaled
+ *         (nearest) as opaque ARGB8888 pixels, in a single pass over the
+ *         source. Uses the arithmetic grayscale conversion.
+ * @param  imgSrc  RGB565 source image
+ * @param  imgDst  ARGB8888 destination image, at least twice the source size.
+ *                 The result is written to its top-left corner (e.g. the whole
+ *                 LCD frame buffer, or a view on it).
+ * @param  imgGray Optional GRAY8 copy of the source (same size), NULL if unused
+ * @retval None
+ */
+void ImgToARGB8888Scaled(Image_t *imgSrc, Image_t *imgDst, Image_t *imgGray)
+{
+  IMG_ASSERT(imgSrc->format == PXFMT_RGB565);
+  IMG_ASSERT(imgSrc->pData != NULL);
+  IMG_ASSERT(imgDst->pData != NULL);
+  IMG_ASSERT(((uintptr_t) imgDst->pData & 0x3u) == 0);
+  IMG_ASSERT((IMG_STRIDE(imgDst) & 0x3u) == 0);
+  IMG_ASSERT((IMG_STRIDE(imgSrc) & 0x1u) == 0);
+  IMG_ASSERT(imgDst->format == PXFMT_ARGB8888);
+  IMG_ASSERT(imgDst->width >= 2 * imgSrc->width);
+  IMG_ASSERT(imgDst->height >= 2 * imgSrc->height);
+  IMG_ASSERT(imgGray == NULL || imgGray->pData != NULL);
+  IMG_ASSERT(imgGray == NULL || imgGray->format == PXFMT_GRAY8);
+  IMG_ASSERT(imgGray == NULL || imgGray->width == imgSrc->width);
+  IMG_ASSERT(imgGray == NULL || imgGray->height == imgSrc->height);
+
+  rgb565_to_gray_argb8888_x2(imgSrc->pData, IMG_STRIDE(imgSrc) / 2,
+                             imgSrc->width, imgSrc->height,
+                             imgDst->pData, IMG_STRIDE(imgDst) / 4,
+                             (imgGray != NULL) ? imgGray->pData : NULL,
+                             (imgGray != NULL) ? IMG_STRIDE(imgGray) : 0);
+}
 
-    default:
-      break;
+/**
+ * @brief  Fills a 256-entry palette mapping the GRAY8 levels to opaque
+ *         ARGB8888 colors, as loaded in the DMA2D CLUT for L8 inputs. Memory
+ *         read by the DMA2D must then be cleaned from the D-Cache.
+ * @param  palette  IMG_PALETTE_GRAY or IMG_PALETTE_FALSE_COLOR
+ * @param  pClut    Palette, 256 entries
+ * @retval None
+ */
+void ImgPaletteInit(imgpalette_t palette, uint32_t *pClut)
+{
+  IMG_ASSERT(pClut != NULL);
+
+  for (int32_t v = 0; v < 256; v++)
+    {
+      if (palette == IMG_PALETTE_FALSE_COLOR)
+        {
+          /* Jet map: each component is a clamped triangle 1.5 wide,
+           * peaking at 3/4 (red), 1/2 (green) and 1/4 (blue) of the range */
+          int32_t c[3];
+
+          for (int32_t k = 0; k < 3; k++)
+            {
+              const int32_t d = 4 * v - (3 - k) * 255;
+
+              c[k] = 383 - ((d < 0) ? -d : d);
+              c[k] = (c[k] < 0) ? 0 : ((c[k] > 255) ? 255 : c[k]);
+            }
+          pClut[v] = 0xff000000u | ((uint32_t) c[0] << 16) |
+                     ((uint32_t) c[1] << 8) | (uint32_t) c[2];
+        }
+      else
+        {
+          pClut[v] = 0xff000000u | ((uint32_t) v * 0x010101u);
+        }
     }
 }
 
@@ -137,21 +324,28 @@ void ImgToRGB565_DMA2D(DMA2D_HandleTypeDef *hdma2d, Image_t *imgSrc,
   IMG_ASSERT(imgDst->format == PXFMT_RGB565);
   IMG_ASSERT(imgDst->width <= 0x3fff);
   IMG_ASSERT(imgDst->height <= 0xffff);
+  IMG_ASSERT(IMG_STRIDE(imgSrc) % IMG_BYTES_PER_PX(imgSrc->format) == 0);
+  IMG_ASSERT(IMG_STRIDE(imgDst) % IMG_BYTES_PER_PX(imgDst->format) == 0);
 
   const uint32_t width = imgSrc->width;
   const uint32_t height = imgSrc->height;
   const uint32_t pSrc = (uint32_t) imgSrc->pData;
   const uint32_t pDst = (uint32_t) imgDst->pData;
+  /* Line offsets, in pixels, for views on larger buffers */
+  const uint32_t src_offset =
+    IMG_STRIDE(imgSrc) / IMG_BYTES_PER_PX(imgSrc->format) - width;
+  const uint32_t dst_offset =
+    IMG_STRIDE(imgDst) / IMG_BYTES_PER_PX(imgDst->format) - width;
 
   hdma2d->Instance = DMA2D;
   hdma2d->Init.Mode = DMA2D_M2M_PFC;
   hdma2d->Init.ColorMode = DMA2D_OUTPUT_RGB565;
-  hdma2d->Init.OutputOffset = 0;
+  hdma2d->Init.OutputOffset = dst_offset;
   hdma2d->Init.AlphaInverted = DMA2D_REGULAR_ALPHA;
   hdma2d->Init.RedBlueSwap = DMA2D_RB_SWAP;
 
   /* Configure foreground input layer */
-  hdma2d->LayerCfg[1].InputOffset = 0;
+  hdma2d->LayerCfg[1].InputOffset = src_offset;
   hdma2d->LayerCfg[1].InputColorMode = DMA2D_INPUT_RGB888;
   hdma2d->LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
   hdma2d->LayerCfg[1].InputAlpha = 0xFF;
@@ -177,21 +371,28 @@ void ImgToRGB888_DMA2D(DMA2D_HandleTypeDef *hdma2d, Image_t *imgSrc, Image_t *im
   IMG_ASSERT(imgDst->format == PXFMT_RGB888);
   IMG_ASSERT(imgDst->width <= 0x3fff);
   IMG_ASSERT(imgDst->height <= 0xffff);
+  IMG_ASSERT(IMG_STRIDE(imgSrc) % IMG_BYTES_PER_PX(imgSrc->format) == 0);
+  IMG_ASSERT(IMG_STRIDE(imgDst) % IMG_BYTES_PER_PX(imgDst->format) == 0);
 
   const uint32_t width = imgSrc->width;
   const uint32_t height = imgSrc->height;
   const uint32_t pSrc = (uint32_t) imgSrc->pData;
   const uint32_t pDst = (uint32_t) imgDst->pData;
+  /* Line offsets, in pixels, for views on larger buffers */
+  const uint32_t src_offset =
+    IMG_STRIDE(imgSrc) / IMG_BYTES_PER_PX(imgSrc->format) - width;
+  const uint32_t dst_offset =
+    IMG_STRIDE(imgDst) / IMG_BYTES_PER_PX(imgDst->format) - width;
 
   hdma2d->Instance = DMA2D;
   hdma2d->Init.Mode          = DMA2D_M2M_PFC;
   hdma2d->Init.ColorMode     = DMA2D_OUTPUT_RGB888;
-  hdma2d->Init.OutputOffset  = 0;
+  hdma2d->Init.OutputOffset  = dst_offset;
   hdma2d->Init.AlphaInverted = DMA2D_REGULAR_ALPHA;
   hdma2d->Init.RedBlueSwap   = DMA2D_RB_REGULAR;
 
   /* Configure foreground input layer */
-  hdma2d->LayerCfg[1].InputOffset    = 0;
+  hdma2d->LayerCfg[1].InputOffset    = src_offset;
   hdma2d->LayerCfg[1].InputColorMode = DMA2D_INPUT_RGB565;
   hdma2d->LayerCfg[1].AlphaMode      = DMA2D_NO_MODIF_ALPHA;
   hdma2d->LayerCfg[1].InputAlpha     = 0xFF;
@@ -205,25 +406,251 @@ void ImgToRGB888_DMA2D(DMA2D_HandleTypeDef *hdma2d, Image_t *imgSrc, Image_t *im
   }
 }
 
+/**
+ * @brief  Converts a GRAY8 image to ARGB8888 with the DMA2D, each gray level
+ *         going through the palette loaded in the foreground CLUT (L8
+ *         input). Waits for the CLUT loading, then starts the transfer like
+ *         ImgToRGB565_DMA2D().
+ * @param  hdma2d  DMA2D handle
+ * @param  imgSrc  GRAY8 source image
+ * @param  imgDst  ARGB8888 destination image, same size
+ * @param  pClut   256 ARGB8888 entries (e.g. from ImgPaletteInit()), cleaned
+ *                 from the D-Cache like the source image
+ * @retval None
+ */
+void ImgToARGB8888_DMA2D(DMA2D_HandleTypeDef *hdma2d, Image_t *imgSrc, Image_t *imgDst,
+                         const uint32_t *pClut)
+{
+  IMG_ASSERT(imgSrc->format == PXFMT_GRAY8); /* Only GRAY8 is supported */
+  IMG_ASSERT(imgSrc->pData != NULL);
+  IMG_ASSERT(imgSrc->width == imgDst->width);
+  IMG_ASSERT(imgSrc->height == imgDst->height);
+  IMG_ASSERT(imgDst->pData != NULL);
+  IMG_ASSERT(imgDst->format == PXFMT_ARGB8888);
+  IMG_ASSERT(imgDst->width <= 0x3fff);
+  IMG_ASSERT(imgDst->height <= 0xffff);
+  IMG_ASSERT(IMG_STRIDE(imgDst) % IMG_BYTES_PER_PX(imgDst->format) == 0);
+  IMG_ASSERT(pClut != NULL);
+
+  const uint32_t width = imgSrc->width;
+  const uint32_t height = imgSrc->height;
+  const uint32_t pSrc = (uint32_t) imgSrc->pData;
+  const uint32_t pDst = (uint32_t) imgDst->pData;
+  /* Line offsets, in pixels, for views on larger buffers */
+  const uint32_t src_offset = IMG_STRIDE(imgSrc) - width;
+  const uint32_t dst_offset =
+    IMG_STRIDE(imgDst) / IMG_BYTES_PER_PX(imgDst->format) - width;
+  DMA2D_CLUTCfgTypeDef clut;
+
+  hdma2d->Instance = DMA2D;
+  hdma2d->Init.Mode          = DMA2D_M2M_PFC;
+  hdma2d->Init.ColorMode     = DMA2D_OUTPUT_ARGB8888;
+  hdma2d->Init.OutputOffset  = dst_offset;
+  hdma2d->Init.AlphaInverted = DMA2D_REGULAR_ALPHA;
+  hdma2d->Init.RedBlueSwap   = DMA2D_RB_REGULAR;
+
+  /* Configure foreground input layer */
+  hdma2d->LayerCfg[1].InputOffset    = src_offset;
+  hdma2d->LayerCfg[1].InputColorMode = DMA2D_INPUT_L8;
+  hdma2d->LayerCfg[1].AlphaMode      = DMA2D_NO_MODIF_ALPHA;
+  hdma2d->LayerCfg[1].InputAlpha     = 0xFF;
+  hdma2d->LayerCfg[1].AlphaInverted  = DMA2D_REGULAR_ALPHA;
+  hdma2d->LayerCfg[1].RedBlueSwap    = DMA2D_RB_REGULAR;
+
+  clut.pCLUT = (uint32_t *) pClut;
+  clut.CLUTColorMode = DMA2D_CCM_ARGB8888;
+  clut.Size = 255;
+
+  if (HAL_DMA2D_Init(hdma2d) == HAL_OK) {
+    if (HAL_DMA2D_ConfigLayer(hdma2d, 1) == HAL_OK) {
+      if (HAL_DMA2D_CLUTLoad(hdma2d, clut, 1) == HAL_OK) {
+        if (HAL_DMA2D_PollForTransfer(hdma2d, 10) == HAL_OK) {
+          HAL_DMA2D_Start(hdma2d, pSrc, pDst, width, height);
+        }
+      }
+    }
+  }
+}
+
 #endif /* DMA2D */
 
+#if IMG_USE_SIMD
+/* BT.601 weights packed as signed halfword pairs for __SMLAD. The green
+ * weight (38470) does not fit a signed halfword: green is fed doubled and
+ * weighted by 38470 / 2 instead, which gives the very same sum. */
+#define GRAY_W_R_G2  ((19235u << 16) | 19595u) /* hi: 2*green, lo: red */
+#define GRAY_W_R_B   (( 7471u << 16) | 19595u) /* hi: blue,    lo: red */
+
+/* Converts two packed RGB565 pixels, returns the gray values in the low byte
+ * of each halfword. */
+static inline uint32_t rgb565x2_to_gray8x2(uint32_t pixels)
+{
+  /* One component per halfword lane */
+  uint32_t red    = (pixels >> 8) & 0x00f800f8u;
+  uint32_t green2 = (pixels >> 2) & 0x01f801f8u;
+  uint32_t blue   = (pixels << 3) & 0x00f800f8u;
+  uint32_t gray0  = __SMLAD(__PKHBT(red, green2, 16), GRAY_W_R_G2,
+                            (blue & 0xffffu) * 7471 + 0x8000);
+  uint32_t gray1  = __SMLAD(__PKHTB(green2, red, 16), GRAY_W_R_G2,
+                            (blue >> 16) * 7471 + 0x8000);
+  return __PKHTB(gray1, gray0, 16);
+}
+#endif /* IMG_USE_SIMD */
+
+/* Converts one RGB565 pixel, ITU-R BT.601 weights */
+static inline uint8_t rgb565_to_gray(uint32_t pixel)
+{
+  uint32_t red   = ((pixel & 0xf800u) >> 8);
+  uint32_t green = ((pixel & 0x07e0u) >> 3);
+  uint32_t blue  = ((pixel & 0x001fu) << 3);
+  /* Add 2^15 before right-shift for round-to-the-nearest-integer div */
+  return (uint8_t) ((red * 19595 + green * 38470 + blue * 7471 + 0x8000) >> 16);
+}
+
 void rgb565_to_gray8(uint16_t *pIn, uint8_t *pOut, uint32_t num_pixels)
 {
+#if IMG_USE_SIMD
+  /* Two pixels per 32-bit word */
+  for (; num_pixels >= 2; num_pixels -= 2) {
+    uint32_t grays = rgb565x2_to_gray8x2(__UNALIGNED_UINT32(pIn));
+    *pOut++ = (uint8_t) grays;
+    *pOut++ = (uint8_t) (grays >> 16);
+    pIn += 2;
+  }
+#endif /* IMG_USE_SIMD */
   for (uint32_t i = 0; i < num_pixels; i++) {
-    uint16_t pixel = *pIn++;
-    uint32_t red   = ((pixel & 0xf800u) >> 8);
-    uint32_t green = ((pixel & 0x07e0u) >> 3);
-    uint32_t blue  = ((pixel & 0x001fu) << 3);
-    red   = red   * 19595;
-    green = green * 38470;
-    blue  = blue  *  7471;
-    /* Add 2^15 before right-shift for round-to-the-nearest-integer div */
-    *pOut++ = (uint8_t) ((red + green + blue + 0x8000) >> 16);
+    *pOut++ = rgb565_to_gray(*pIn++);
   }
 }
 
+/* Opaque ARGB8888 pixel twice, for one 64-bit store */
+#define GRAY_TO_ARGB8888_X2(gray) \
+  ((0xff000000u | ((gray) * 0x00010101u)) * 0x0000000100000001ull)
+
+static void rgb565_to_gray_argb8888_x2(uint16_t *pIn, uint32_t in_pitch,
+                                       uint32_t width, uint32_t height,
+                                       uint32_t *pOut, uint32_t out_pitch,
+                                       uint8_t *pGray, uint32_t gray_pitch)
+{
+  for (uint32_t row = 0; row < height; row++)
+    {
+      /* Each source pixel gives 2x2 output pixels, i.e. one 64-bit store in
+       * each of the two output rows */
+      uint64_t *pOut0 = (uint64_t *) (pOut + 2 * row * out_pitch);
+      uint64_t *pOut1 = (uint64_t *) (pOut + (2 * row + 1) * out_pitch);
+      uint8_t *pGrayLine = (pGray != NULL) ? pGray + row * gray_pitch : NULL;
+      uint16_t *pInLine = pIn + row * in_pitch;
+      uint32_t col = 0;
+#if IMG_USE_SIMD
+      for (; col + 2 <= width; col += 2)
+        {
+          uint32_t grays = rgb565x2_to_gray8x2(__UNALIGNED_UINT32(pInLine));
+          uint64_t argb0 = GRAY_TO_ARGB8888_X2(grays & 0xffu);
+          uint64_t argb1 = GRAY_TO_ARGB8888_X2(grays >> 16);
+          pOut0[0] = argb0;
+          pOut0[1] = argb1;
+          pOut1[0] = argb0;
+          pOut1[1] = argb1;
+          pOut0 += 2;
+          pOut1 += 2;
+          if (pGrayLine != NULL)
+            {
+              *pGrayLine++ = (uint8_t) grays;
+              *pGrayLine++ = (uint8_t) (grays >> 16);
+            }
+          pInLine += 2;
+        }
+#endif /* IMG_USE_SIMD */
+      for (; col < width; col++)
+        {
+          uint8_t gray = rgb565_to_gray(*pInLine++);
+          uint64_t argb = GRAY_TO_ARGB8888_X2((uint32_t) gray);
+          *pOut0++ = argb;
+          *pOut1++ = argb;
+          if (pGrayLine != NULL)
+            {
+              *pGrayLine++ = gray;
+            }
+        }
+    }
+}
+
+#if defined(USE_IMG_GRAY_LUT)
+static void rgb565_to_gray8_lut(uint16_t *pIn, uint8_t *pOut,
+                                uint32_t num_pixels)
+{
+  for (uint32_t i = 0; i < num_pixels; i++) {
+    *pOut++ = rgb565tograyscale_lut[*pIn++];
+  }
+}
+#endif /* USE_IMG_GRAY_LUT */
+
+static void rgb565_to_gray8_lut_split(uint16_t *pIn, uint8_t *pOut,
+                                      uint32_t num_pixels)
+{
+  const uint32_t *lut_hi = gray_lut_split[0];
+  const uint32_t *lut_lo = gray_lut_split[1];
+
+  for (uint32_t i = 0; i < num_pixels; i++) {
+    uint32_t pixel = *pIn++;
+    *pOut++ = (uint8_t) ((lut_hi[pixel >> 8] + lut_lo[pixel & 0xffu]) >> 16);
+  }
+}
+
+static void gray_lut_split_init(void)
+{
+  if (gray_lut_split_ready)
+    {
+      return;
+    }
+  /* Same weights and rounding as rgb565_to_gray8(): the formula is linear in
+   * the pixel bits, so the two partial sums add up to the exact result. */
+  for (uint32_t i = 0; i < 256; i++)
+    {
+      gray_lut_split[0][i] = (i & 0xf8u) * 19595 +
+                             ((i & 0x07u) << 5) * 38470 + 0x8000;
+      gray_lut_split[1][i] = ((i & 0xe0u) >> 3) * 38470 +
+                             ((i & 0x1fu) << 3) * 7471;
+    }
+  gray_lut_split_ready = 1;
+}
+
+#if IMG_USE_SIMD
+/* Expand two packed RGB565 pixels to 8-bit components, one per halfword lane,
+ * with the same MSBs-to-LSBs replication as the scalar code. */
+#define RGB565X2_RED(p)   ((((p) >> 8) & 0x00f800f8u) | (((p) >> 13) & 0x00070007u))
+#define RGB565X2_GREEN(p) ((((p) >> 3) & 0x00fc00fcu) | (((p) >> 9) & 0x00030003u))
+#define RGB565X2_BLUE(p)  ((((p) << 3) & 0x00f800f8u) | (((p) >> 2) & 0x00070007u))
+#endif /* IMG_USE_SIMD */
+
 void rgb565_to_rgb888(uint16_t *pIn, uint8_t *pOut, uint32_t num_pixels)
 {
+#if IMG_USE_SIMD
+  /* Four pixels (two input words) per three output words */
+  for (; num_pixels >= 4; num_pixels -= 4)
+    {
+      uint32_t pixels01 = __UNALIGNED_UINT32(pIn);
+      uint32_t pixels23 = __UNALIGNED_UINT32(pIn + 2);
+      uint32_t red01 = RGB565X2_RED(pixels01);
+      uint32_t green01 = RGB565X2_GREEN(pixels01);
+      uint32_t blue01 = RGB565X2_BLUE(pixels01);
+      uint32_t red23 = RGB565X2_RED(pixels23);
+      uint32_t green23 = RGB565X2_GREEN(pixels23);
+      uint32_t blue23 = RGB565X2_BLUE(pixels23);
+      uint32_t rg01 = red01 | (green01 << 8);   /* G1 R1 | G0 R0 */
+      uint32_t gb01 = green01 | (blue01 << 8);  /* B1 G1 | B0 G0 */
+      uint32_t rg23 = red23 | (green23 << 8);   /* G3 R3 | G2 R2 */
+      uint32_t gb23 = green23 | (blue23 << 8);  /* B3 G3 | B2 G2 */
+      /* R0 G0 B0 R1 | G1 B1 R2 G2 | B2 R3 G3 B3 */
+      __UNALIGNED_UINT32(pOut) =
+        (rg01 & 0x0000ffffu) | (blue01 << 16) | ((red01 << 8) & 0xff000000u);
+      __UNALIGNED_UINT32(pOut + 4) = __PKHBT(gb01 >> 16, rg23, 16);
+      __UNALIGNED_UINT32(pOut + 8) =
+        (gb23 & 0xffff0000u) | (blue23 & 0xffu) | ((red23 >> 8) & 0xff00u);
+      pIn += 4;
+      pOut += 12;
+    }
+#endif /* IMG_USE_SIMD */
   for (uint32_t i = 0; i < num_pixels; i++)
     {
       uint16_t pixel = *pIn++;
@@ -243,6 +670,20 @@ void rgb565_to_rgb888(uint16_t *pIn, uint8_t *pOut, uint32_t num_pixels)
 
 void rgb565_to_argb8888(uint16_t *pIn, uint8_t *pOut, uint32_t num_pixels)
 {
+#if IMG_USE_SIMD
+  /* Two pixels per input word, one output word per pixel */
+  for (; num_pixels >= 2; num_pixels -= 2)
+    {
+      uint32_t pixels = __UNALIGNED_UINT32(pIn);
+      uint32_t ar = (RGB565X2_RED(pixels) << 8) | 0x00ff00ffu; /* R1 FF | R0 FF */
+      uint32_t gb = RGB565X2_GREEN(pixels) | (RGB565X2_BLUE(pixels) << 8);
+      /* Byte order in memory: FF R G B */
+      __UNALIGNED_UINT32(pOut) = __PKHBT(ar, gb, 16);
+      __UNALIGNED_UINT32(pOut + 4) = __PKHTB(gb, ar, 16);
+      pIn += 2;
+      pOut += 8;
+    }
+#endif /* IMG_USE_SIMD */
   for (uint32_t i = 0; i < num_pixels; i++)
     {
       uint16_t pixel = *pIn++;
@@ -264,6 +705,34 @@ void rgb565_to_argb8888(uint16_t *pIn, uint8_t *pOut, uint32_t num_pixels)
 void rgb888_to_gray8(uint8_t *pIn, uint8_t *pOut, uint32_t num_pixels)
 {
   /* ITU-R BT.601-7 Table 2 - Integer coefficients of luminance */
+#if IMG_USE_SIMD
+  /* Four pixels (three input words) per output word */
+  for (; num_pixels >= 4; num_pixels -= 4)
+    {
+      uint32_t w0 = __UNALIGNED_UINT32(pIn);     /* R1 B0 G0 R0 */
+      uint32_t w1 = __UNALIGNED_UINT32(pIn + 4); /* G2 R2 B1 G1 */
+      uint32_t w2 = __UNALIGNED_UINT32(pIn + 8); /* B3 G3 R3 B2 */
+      uint32_t br0 = __UXTB16(w0);               /* B0 | R0 */
+      uint32_t rg01 = __UXTB16(__ROR(w0, 8));    /* R1 | G0 */
+      uint32_t rg12 = __UXTB16(w1);              /* R2 | G1 */
+      uint32_t gb21 = __UXTB16(__ROR(w1, 8));    /* G2 | B1 */
+      uint32_t gb32 = __UXTB16(w2);              /* G3 | B2 */
+      uint32_t br3 = __UXTB16(__ROR(w2, 8));     /* B3 | R3 */
+      uint32_t gray0 = __SMLAD(br0, GRAY_W_R_B,
+                               (rg01 & 0xffffu) * 38470 + 0x8000);
+      uint32_t gray1 = __SMLAD(__PKHBT(rg01 >> 16, gb21, 16), GRAY_W_R_B,
+                               (rg12 & 0xffffu) * 38470 + 0x8000);
+      uint32_t gray2 = __SMLAD(__PKHBT(rg12 >> 16, gb32, 16), GRAY_W_R_B,
+                               (gb21 >> 16) * 38470 + 0x8000);
+      uint32_t gray3 = __SMLAD(br3, GRAY_W_R_B,
+                               (gb32 >> 16) * 38470 + 0x8000);
+      __UNALIGNED_UINT32(pOut) = (gray0 >> 16) | ((gray1 >> 8) & 0xff00u) |
+                                 (gray2 & 0xff0000u) |
+                                 ((gray3 << 8) & 0xff000000u);
+      pIn += 12;
+      pOut += 4;
+    }
+#endif /* IMG_USE_SIMD */
   for (uint32_t i = 0; i < num_pixels; i++)
     {
       uint32_t red = *pIn++ * 19595;
@@ -276,6 +745,34 @@ void rgb888_to_gray8(uint8_t *pIn, uint8_t *pOut, uint32_t num_pixels)
 
 void rgb888_to_rgb565(uint8_t *pIn, uint16_t *pOut, uint32_t num_pixels)
 {
+#if IMG_USE_SIMD
+  /* Four pixels (three input words) per two output words */
+  for (; num_pixels >= 4; num_pixels -= 4) {
+    uint32_t w0 = __UNALIGNED_UINT32(pIn);     /* R1 B0 G0 R0 */
+    uint32_t w1 = __UNALIGNED_UINT32(pIn + 4); /* G2 R2 B1 G1 */
+    uint32_t w2 = __UNALIGNED_UINT32(pIn + 8); /* B3 G3 R3 B2 */
+    uint32_t br0 = __UXTB16(w0);               /* B0 | R0 */
+    uint32_t rg01 = __UXTB16(__ROR(w0, 8));    /* R1 | G0 */
+    uint32_t rg12 = __UXTB16(w1);              /* R2 | G1 */
+    uint32_t gb21 = __UXTB16(__ROR(w1, 8));    /* G2 | B1 */
+    uint32_t gb32 = __UXTB16(w2);              /* G3 | B2 */
+    uint32_t br3 = __UXTB16(__ROR(w2, 8));     /* B3 | R3 */
+    uint32_t red = __PKHBT(br0, rg01, 0);           /* R1 | R0 */
+    uint32_t green = __PKHBT(rg01, rg12, 16);       /* G1 | G0 */
+    uint32_t blue = __PKHBT(br0 >> 16, gb21, 16);   /* B1 | B0 */
+    __UNALIGNED_UINT32(pOut) = ((red & 0x00f800f8u) << 8) |
+                               ((green & 0x00fc00fcu) << 3) |
+                               ((blue >> 3) & 0x001f001fu);
+    red = __PKHBT(rg12 >> 16, br3, 16);             /* R3 | R2 */
+    green = __PKHTB(gb32, gb21, 16);                /* G3 | G2 */
+    blue = __PKHBT(gb32, br3, 0);                   /* B3 | B2 */
+    __UNALIGNED_UINT32(pOut + 2) = ((red & 0x00f800f8u) << 8) |
+                                   ((green & 0x00fc00fcu) << 3) |
+                                   ((blue >> 3) & 0x001f001fu);
+    pIn += 12;
+    pOut += 4;
+  }
+#endif /* IMG_USE_SIMD */
   for (uint32_t i = 0; i < num_pixels; i++) {
     uint32_t red   = *pIn++ >> 3;
     uint32_t green = *pIn++ >> 2;
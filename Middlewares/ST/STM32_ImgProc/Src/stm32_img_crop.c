@@ -14,38 +14,67 @@ void ImgCropCenter(Image_t *imgSrc, Image_t *imgDst)
   IMG_ASSERT(imgSrc->height >= imgDst->height);
 
   ImgRect_t crop_rect;
-  crop_rect.x0 = (imgSrc->height - imgDst->height) / 2;
-  crop_rect.y0 = (imgSrc->width - imgDst->width) / 2;
+  crop_rect.x0 = (imgSrc->width - imgDst->width) / 2;
+  crop_rect.y0 = (imgSrc->height - imgDst->height) / 2;
   crop_rect.width = imgDst->width;
   crop_rect.height = imgDst->height;
 
   ImgCrop(imgSrc, imgDst, &crop_rect);
 }
 
+/**
+ * @brief  Makes imgView describe the cropRect area of imgSrc, without copying
+ *         any pixel. The view shares the source buffer and line pitch.
+ * @param  imgSrc   Source image
+ * @param  imgView  View to initialize
+ * @param  cropRect Area of the source image covered by the view
+ * @retval None
+ */
+void ImgCropView(Image_t *imgSrc, Image_t *imgView, ImgRect_t *cropRect)
+{
+  IMG_ASSERT(cropRect->x0 + cropRect->width <= imgSrc->width);
+  IMG_ASSERT(cropRect->y0 + cropRect->height <= imgSrc->height);
+  IMG_ASSERT(imgSrc->pData != NULL);
+
+  const uint32_t stride = IMG_STRIDE(imgSrc);
+  const uint32_t pixel_size = IMG_BYTES_PER_PX(imgSrc->format);
+
+  imgView->width = cropRect->width;
+  imgView->height = cropRect->height;
+  imgView->format = imgSrc->format;
+  imgView->stride = stride;
+  imgView->pData = (uint8_t *)imgSrc->pData + cropRect->y0 * stride +
+                   cropRect->x0 * pixel_size;
+}
+
 void ImgCrop(Image_t *imgSrc, Image_t *imgDst, ImgRect_t *cropRect)
 {
-  IMG_ASSERT(imgSrc->width >= cropRect->width);
-  IMG_ASSERT(imgSrc->height >= cropRect->height);
+  IMG_ASSERT(cropRect->x0 + cropRect->width <= imgSrc->width);
+  IMG_ASSERT(cropRect->y0 + cropRect->height <= imgSrc->height);
   IMG_ASSERT(imgSrc->pData != NULL);
   IMG_ASSERT(imgDst->pData != NULL);
   IMG_ASSERT(imgSrc->format == imgDst->format);
 
-  const uint32_t src_width = imgSrc->width;
   const uint32_t dst_width = cropRect->width;
   const uint32_t dst_height = cropRect->height;
   const uint32_t left = cropRect->x0;
   const uint32_t top = cropRect->y0;
 
   const uint32_t pixel_size = IMG_BYTES_PER_PX(imgSrc->format);
+  const uint32_t src_stride = IMG_STRIDE(imgSrc);
+  const uint32_t dst_stride = (imgDst->stride != 0) ? imgDst->stride
+                                                    : dst_width * pixel_size;
 
-  const uint8_t *pIn = (uint8_t *)imgSrc->pData + left * pixel_size;
+  const uint8_t *pIn = (uint8_t *)imgSrc->pData + top * src_stride +
+                       left * pixel_size;
   uint8_t *pOut = (uint8_t *)imgDst->pData;
 
   /* Copy line per line */
+  const size_t dst_line_size = dst_width * pixel_size;
   for (uint32_t i = 0; i < dst_height; i++)
   {
-    const size_t dst_line_size = dst_width * pixel_size;
-    memcpy(pOut, pIn + (i + top) * src_width * pixel_size, dst_line_size);
-    pOut += dst_line_size;
+    memcpy(pOut, pIn, dst_line_size);
+    pIn += src_stride;
+    pOut += dst_stride;
   }
 }
@@ -6,73 +6,1315 @@
 
 #include "stm32_img.h"
 #include <stddef.h>
+#include <string.h>
+#if defined(DMA2D)
+#include "D2D_resize.h"
+#endif
+
+/* Geometry the workspace tables are built for */
+typedef struct
+{
+  uint32_t intrpl;
+  uint32_t pixelSize;
+  uint32_t format;
+  uint32_t srcStride;
+  uint32_t roiX;
+  uint32_t roiY;
+  uint32_t roiW;
+  uint32_t roiH;
+  uint32_t dstW;
+  uint32_t dstH;
+  uint32_t valid;
+} ResizeGeometry_t;
+
+/* Bilinear tables, laid out in the workspace buffer. Positions are sampled at
+ * roi + dst * roi_size / dst_size (Q16), weights are Q8 and give the share of
+ * the right (lower) sample. */
+typedef struct
+{
+  uint32_t *yOfs0; /* [dstH] Byte offset of the upper source line  */
+  uint32_t *yOfs1; /* [dstH] Byte offset of the lower source line  */
+  uint16_t *xOfs0; /* [dstW] Byte offset of the left source pixel  */
+  uint16_t *xOfs1; /* [dstW] Byte offset of the right source pixel */
+  uint16_t *xW;    /* [dstW] Horizontal weight                     */
+  uint16_t *yW;    /* [dstH] Vertical weight                       */
+} BilinearTables_t;
+
+/* Bicubic tables, laid out in the workspace buffer. Same sampling positions as
+ * bilinear, 4 taps per output column (row) clamped to the ROI, Keys weights
+ * (a = -0.5) in Q12. The ring holds the last horizontally filtered source
+ * lines (Q8), one per (source line % 4). */
+typedef struct
+{
+  int32_t *ring;    /* [4][dstW * 4] Horizontally filtered source lines */
+  int32_t *ringRow; /* [4] Source line held by each ring entry, or -1   */
+  uint16_t *xOfs;   /* [dstW][4] Byte offsets of the source pixels      */
+  int16_t *xW;      /* [dstW][4] Horizontal weights                     */
+  uint16_t *yRow;   /* [dstH][4] Source lines, relative to the ROI      */
+  int16_t *yW;      /* [dstH][4] Vertical weights                       */
+} BicubicTables_t;
+
+#define BICUBIC_TAPS 4
+#define BICUBIC_ONE  4096 /* 1.0 in Q12 */
+
+/* Workspace of ImgResize() and ImgResizeCrop() */
+static uint32_t resize_ws_buffer[(IMG_RESIZE_WS_SIZE + 3) / 4];
+static ImgResizeWs_t resize_ws;
+
+#if defined(DMA2D)
+/* Completion callback of the DMA2D resize in progress */
+static ImgResizeCallback_t dma2d_resize_callback = NULL;
+static void *dma2d_resize_context = NULL;
+
+static uint32_t Resize_DMA2DColorMode(pxfmt_t format);
+#endif
 
 static void ImageResize_NearestNeighbor(uint8_t *srcImage, uint32_t srcW, uint32_t srcH,
-                                        uint32_t pixelSize, uint32_t roiX, uint32_t roiY,
+                                        uint32_t srcStride, uint32_t pixelSize,
+                                        uint32_t roiX, uint32_t roiY,
                                         uint32_t roiW, uint32_t roiH, uint8_t *dstImage,
-                                        uint32_t dstW, uint32_t dstH);
-static void ImageResize_Bilinear(uint8_t *srcImage, uint32_t srcW, uint32_t srcH,
-                                 uint32_t pixelSize, uint32_t roiX, uint32_t roiY,
-                                 uint32_t roiW, uint32_t roiH, uint8_t *dstImage,
-                                 uint32_t dstW, uint32_t dstH);
+                                        uint32_t dstW, uint32_t dstH, uint32_t dstStride);
+static void BilinearTables_Map(ImgResizeWs_t *ws, uint32_t dstW, uint32_t dstH,
+                               BilinearTables_t *tables);
+static void BilinearTables_Build(BilinearTables_t *tables, ResizeGeometry_t *geo);
+static void ImageResize_BilinearQ8(uint8_t *srcImage, BilinearTables_t *tables,
+                                   pxfmt_t format, uint32_t pixelSize,
+                                   uint8_t *dstImage, uint32_t dstW,
+                                   uint32_t dstH, uint32_t dstStride);
+static void BicubicTables_Map(ImgResizeWs_t *ws, uint32_t dstW, uint32_t dstH,
+                              BicubicTables_t *tables);
+static void BicubicTables_Build(BicubicTables_t *tables, ResizeGeometry_t *geo);
+static void ImageResize_BicubicQ12(uint8_t *srcImage, BicubicTables_t *tables,
+                                   ResizeGeometry_t *geo, uint8_t *dstImage,
+                                   uint32_t dstStride);
+static void ImageResize_Area(uint8_t *srcImage, uint32_t srcStride,
+                             pxfmt_t format, uint32_t roiX, uint32_t roiY,
+                             uint32_t roiW, uint32_t roiH, uint8_t *dstImage,
+                             uint32_t dstW, uint32_t dstH, uint32_t dstStride);
+static void ImageResize_AreaWs(uint8_t *srcImage, uint32_t srcStride,
+                               pxfmt_t format, uint32_t roiX, uint32_t roiY,
+                               uint32_t roiW, uint32_t roiH, uint8_t *dstImage,
+                               uint32_t dstW, uint32_t dstH, uint32_t dstStride,
+                               uint32_t *acc);
 
 
-void ImgResize(Image_t *imgSrc, Image_t *imgDst, intrpl_t intrpl)
+/**
+ * @brief  Resizes an image. BILINEAR and BICUBIC run ImgResizeCropEx() on a
+ *         static workspace of IMG_RESIZE_WS_SIZE bytes.
+ * @param  imgSrc  Source image
+ * @param  imgDst  Destination image
+ * @param  intrpl  Interpolation method
+ * @retval IMG_OK, IMG_ERROR_SIZE if the tables exceed IMG_RESIZE_WS_SIZE
+ */
+imgstatus_t ImgResize(Image_t *imgSrc, Image_t *imgDst, intrpl_t intrpl)
 {
-  IMG_ASSERT(intrpl == NEAREST || intrpl == BILINEAR);
+  return ImgResizeCrop(imgSrc, imgDst, NULL, intrpl);
+}
+
+/**
+ * @brief  Resizes a Region Of Interest of an image. BILINEAR and BICUBIC run
+ *         ImgResizeCropEx() on a static workspace of IMG_RESIZE_WS_SIZE bytes,
+ *         whose tables are rebuilt when the geometry changes: not reentrant.
+ * @param  imgSrc  Source image
+ * @param  imgDst  Destination image
+ * @param  roi     Region Of Interest of the source image, NULL for all of it
+ * @param  intrpl  Interpolation method
+ * @retval IMG_OK, IMG_ERROR_SIZE if the tables exceed IMG_RESIZE_WS_SIZE
+ */
+imgstatus_t ImgResizeCrop(Image_t *imgSrc, Image_t *imgDst, ImgRect_t* roi, intrpl_t intrpl)
+{
+  IMG_ASSERT(intrpl <= AREA);
   IMG_ASSERT(imgSrc->pData != NULL);
   IMG_ASSERT(imgSrc->format == imgDst->format);
   IMG_ASSERT(imgDst->pData != NULL);
 
   const uint32_t pixel_size = IMG_BYTES_PER_PX(imgSrc->format);
+  ImgRect_t full = {0, 0, imgSrc->width, imgSrc->height};
+
+  if (roi == NULL)
+  {
+    roi = &full;
+  }
 
   switch (intrpl)
   {
   case NEAREST:
     ImageResize_NearestNeighbor(imgSrc->pData, imgSrc->width, imgSrc->height,
-                                pixel_size, 0, 0, imgSrc->width, imgSrc->height,
-                                imgDst->pData, imgDst->width, imgDst->height);
+                                IMG_STRIDE(imgSrc), pixel_size,
+                                roi->x0, roi->y0, roi->width, roi->height,
+                                imgDst->pData, imgDst->width, imgDst->height,
+                                IMG_STRIDE(imgDst));
     break;
 
   case BILINEAR:
-    ImageResize_Bilinear(imgSrc->pData, imgSrc->width, imgSrc->height,
-                         pixel_size, 0, 0, imgSrc->width, imgSrc->height,
-                         imgDst->pData, imgDst->width, imgDst->height);
+  case BICUBIC:
+    if (resize_ws.pBuffer == NULL)
+    {
+      ImgResizeWsInit(&resize_ws, resize_ws_buffer, sizeof(resize_ws_buffer));
+    }
+    return ImgResizeCropEx(imgSrc, imgDst, roi, intrpl, &resize_ws);
+
+  case AREA:
+    ImageResize_Area(imgSrc->pData, IMG_STRIDE(imgSrc), imgSrc->format,
+                     roi->x0, roi->y0, roi->width, roi->height,
+                     imgDst->pData, imgDst->width, imgDst->height,
+                     IMG_STRIDE(imgDst));
     break;
 
   default:
     break;
   }
 
+  return IMG_OK;
+}
+
+/**
+ * @brief  Gets the workspace size needed by ImgResizeCropEx() for a given
+ *         destination size.
+ * @param  dstWidth  Destination image width
+ * @param  dstHeight Destination image height
+ * @param  intrpl    Interpolation method
+ * @retval Size in bytes, 0 if the method needs no workspace
+ */
+uint32_t ImgResizeWsSize(uint32_t dstWidth, uint32_t dstHeight, intrpl_t intrpl)
+{
+  switch (intrpl)
+  {
+  case BILINEAR:
+    return dstHeight * (2 * sizeof(uint32_t) + sizeof(uint16_t)) +
+           dstWidth * 3 * sizeof(uint16_t);
+
+  case BICUBIC:
+    /* Ring sized for 4 components per pixel */
+    return (BICUBIC_TAPS * dstWidth * 4 + BICUBIC_TAPS) * sizeof(int32_t) +
+           (dstWidth + dstHeight) * BICUBIC_TAPS *
+           (sizeof(uint16_t) + sizeof(int16_t));
+
+  case AREA:
+    /* One accumulator per destination component */
+    return dstWidth * 4 * sizeof(uint32_t);
+
+  default:
+    return 0;
+  }
+}
+
+/**
+ * @brief  Initializes a resize workspace.
+ * @param  ws      Workspace to initialize
+ * @param  pBuffer Tables memory, 4-byte aligned, see ImgResizeWsSize()
+ * @param  size    Size of pBuffer in bytes
+ * @retval None
+ */
+void ImgResizeWsInit(ImgResizeWs_t *ws, void *pBuffer, uint32_t size)
+{
+  IMG_ASSERT(sizeof(ws->geometry) == sizeof(ResizeGeometry_t));
+  IMG_ASSERT(((uintptr_t) pBuffer & 0x3u) == 0);
+
+  ws->pBuffer = pBuffer;
+  ws->size = size;
+  memset(ws->geometry, 0, sizeof(ws->geometry));
 }
 
-void ImgResizeCrop(Image_t *imgSrc, Image_t *imgDst, ImgRect_t* roi, intrpl_t intrpl)
+/**
+ * @brief  Resizes a Region Of Interest of an image, using tables cached in a
+ *         workspace. Calls with the same geometry (source size and stride,
+ *         ROI, destination size, format, method) reuse the tables as is.
+ *         BILINEAR is computed in fixed point with per-pixel-size inner loops,
+ *         RGB565 being interpolated per component. BICUBIC is separable:
+ *         source lines are filtered horizontally once into a ring of 4 lines,
+ *         then combined vertically, without any full-frame temporary. AREA
+ *         averages the source pixels covered by each destination pixel, with
+ *         line accumulators (and packed adds on 2x and 4x reductions).
+ * @param  imgSrc  Source image
+ * @param  imgDst  Destination image
+ * @param  roi     Region Of Interest of the source image, NULL for all of it
+ * @param  intrpl  Interpolation method
+ * @param  ws      Workspace, initialized with ImgResizeWsInit()
+ * @retval IMG_OK, IMG_ERROR_SIZE if the workspace is too small
+ */
+imgstatus_t ImgResizeCropEx(Image_t *imgSrc, Image_t *imgDst, ImgRect_t *roi,
+                            intrpl_t intrpl, ImgResizeWs_t *ws)
 {
-  IMG_ASSERT(intrpl == NEAREST || intrpl == BILINEAR);
+  IMG_ASSERT(intrpl <= AREA);
   IMG_ASSERT(imgSrc->pData != NULL);
   IMG_ASSERT(imgSrc->format == imgDst->format);
   IMG_ASSERT(imgDst->pData != NULL);
+  IMG_ASSERT(ws != NULL);
 
   const uint32_t pixel_size = IMG_BYTES_PER_PX(imgSrc->format);
+  ImgRect_t full = {0, 0, imgSrc->width, imgSrc->height};
 
-  switch (intrpl)
+  if (roi == NULL)
+  {
+    roi = &full;
+  }
+  IMG_ASSERT(roi->x0 + roi->width <= imgSrc->width);
+  IMG_ASSERT(roi->y0 + roi->height <= imgSrc->height);
+  IMG_ASSERT(imgSrc->width * pixel_size <= 0xffff);
+
+  if (intrpl == NEAREST)
   {
-  case NEAREST:
     ImageResize_NearestNeighbor(imgSrc->pData, imgSrc->width, imgSrc->height,
-                                pixel_size, roi->x0, roi->y0, roi->width, roi->height,
-                                imgDst->pData, imgDst->width, imgDst->height);
-    break;
+                                IMG_STRIDE(imgSrc), pixel_size,
+                                roi->x0, roi->y0, roi->width, roi->height,
+                                imgDst->pData, imgDst->width, imgDst->height,
+                                IMG_STRIDE(imgDst));
+    return IMG_OK;
+  }
 
-  case BILINEAR:
-    ImageResize_Bilinear(imgSrc->pData, imgSrc->width, imgSrc->height,
-                         pixel_size, roi->x0, roi->y0, roi->width, roi->height,
-                         imgDst->pData, imgDst->width, imgDst->height);
-    break;
+  if (ws->size < ImgResizeWsSize(imgDst->width, imgDst->height, intrpl))
+  {
+    return IMG_ERROR_SIZE;
+  }
 
-  default:
-    break;
+  if (intrpl == AREA)
+  {
+    /* No tables, the accumulators overwrite any cached ones */
+    memset(ws->geometry, 0, sizeof(ws->geometry));
+    ImageResize_AreaWs(imgSrc->pData, IMG_STRIDE(imgSrc), imgSrc->format,
+                       roi->x0, roi->y0, roi->width, roi->height,
+                       imgDst->pData, imgDst->width, imgDst->height,
+                       IMG_STRIDE(imgDst), (uint32_t *) ws->pBuffer);
+    return IMG_OK;
+  }
+
+  ResizeGeometry_t geo = {
+    .intrpl = intrpl,
+    .pixelSize = pixel_size,
+    .format = imgSrc->format,
+    .srcStride = IMG_STRIDE(imgSrc),
+    .roiX = roi->x0,
+    .roiY = roi->y0,
+    .roiW = roi->width,
+    .roiH = roi->height,
+    .dstW = imgDst->width,
+    .dstH = imgDst->height,
+    .valid = 1
+  };
+  const uint8_t rebuild = (memcmp(ws->geometry, &geo, sizeof(geo)) != 0);
+
+  if (intrpl == BICUBIC)
+  {
+    BicubicTables_t tables;
+
+    BicubicTables_Map(ws, imgDst->width, imgDst->height, &tables);
+    if (rebuild)
+    {
+      BicubicTables_Build(&tables, &geo);
+    }
+    ImageResize_BicubicQ12(imgSrc->pData, &tables, &geo, imgDst->pData,
+                           IMG_STRIDE(imgDst));
+  }
+  else
+  {
+    BilinearTables_t tables;
+
+    BilinearTables_Map(ws, imgDst->width, imgDst->height, &tables);
+    if (rebuild)
+    {
+      BilinearTables_Build(&tables, &geo);
+    }
+    ImageResize_BilinearQ8(imgSrc->pData, &tables, imgSrc->format, pixel_size,
+                           imgDst->pData, imgDst->width, imgDst->height,
+                           IMG_STRIDE(imgDst));
+  }
+
+  if (rebuild)
+  {
+    memcpy(ws->geometry, &geo, sizeof(geo));
+  }
+
+  return IMG_OK;
+}
+
+/**
+ * @brief  Chooses the resize backend of a call: the DMA2D for bilinear resizes
+ *         of RGB565, RGB888 or ARGB8888 images (same source and destination
+ *         format), when the DMA2D is free and the destination is large
+ *         enough to amortize its per line and per column interrupts
+ *         (IMG_DMA2D_RESIZE_MIN_PIXELS), else the CPU.
+ * @param  imgSrc  Source image
+ * @param  imgDst  Destination image
+ * @param  roi     Region Of Interest, NULL for the whole image
+ * @param  intrpl  Interpolation method
+ * @retval IMG_BACKEND_CPU or IMG_BACKEND_DMA2D
+ */
+imgbackend_t ImgResizeSelectBackend(Image_t *imgSrc, Image_t *imgDst,
+                                    ImgRect_t *roi, intrpl_t intrpl)
+{
+#if defined(DMA2D)
+  const uint32_t roi_w = (roi != NULL) ? roi->width : imgSrc->width;
+  const uint32_t roi_h = (roi != NULL) ? roi->height : imgSrc->height;
+
+  if ((intrpl == BILINEAR) && (imgSrc->format == imgDst->format) &&
+      (Resize_DMA2DColorMode(imgSrc->format) != UINT32_MAX) &&
+      (roi_w >= 2) && (roi_h >= 2) && (roi_h <= IMG_DMA2D_RESIZE_MAX_SIZE) &&
+      (roi_w <= IMG_DMA2D_RESIZE_MAX_SIZE) &&
+      (imgDst->width * imgDst->height >= IMG_DMA2D_RESIZE_MIN_PIXELS) &&
+      !ImgResize_DMA2DBusy() && ImgResize_DMA2DAvailable())
+  {
+    return IMG_BACKEND_DMA2D;
+  }
+#endif
+  return IMG_BACKEND_CPU;
+}
+
+/**
+ * @brief  Resizes an image on the backend chosen by ImgResizeSelectBackend():
+ *         the DMA2D resize is started and the function returns at once, the
+ *         CPU resize is done before returning. In both cases the callback
+ *         gets the completion status.
+ * @param  imgSrc    Source image
+ * @param  imgDst    Destination image
+ * @param  roi       Region Of Interest, NULL for the whole image
+ * @param  intrpl    Interpolation method
+ * @param  ws        CPU resize workspace, NULL to use ImgResizeCrop()
+ * @param  pWork     DMA2D work buffer (ImgResize_DMA2DWorkSize() bytes), NULL
+ *                   to always resize on the CPU
+ * @param  callback  Completion callback, NULL if unused
+ * @param  pContext  Callback argument
+ * @retval IMG_OK if the resize is done or started, else the CPU resize error
+ */
+imgstatus_t ImgResizeCropAsync(Image_t *imgSrc, Image_t *imgDst, ImgRect_t *roi,
+                               intrpl_t intrpl, ImgResizeWs_t *ws,
+                               uint32_t *pWork, ImgResizeCallback_t callback,
+                               void *pContext)
+{
+  imgstatus_t status = IMG_OK;
+
+#if defined(DMA2D)
+  if ((pWork != NULL) &&
+      (ImgResizeSelectBackend(imgSrc, imgDst, roi, intrpl) == IMG_BACKEND_DMA2D) &&
+      (ImgResize_DMA2D(imgSrc, imgDst, roi, pWork, callback, pContext) == IMG_OK))
+  {
+    return IMG_OK;
+  }
+#else
+  (void) pWork;
+#endif
+
+  /* CPU fallback, also when the DMA2D got busy in between */
+  if (ws != NULL)
+  {
+    status = ImgResizeCropEx(imgSrc, imgDst, roi, intrpl, ws);
+  }
+  else
+  {
+    status = ImgResizeCrop(imgSrc, imgDst, roi, intrpl);
+  }
+  if (callback != NULL)
+  {
+    callback(status, pContext);
+  }
+  return status;
+}
+
+#if defined(DMA2D)
+
+/**
+ * @brief  Returns the size of the work buffer of a DMA2D resize.
+ * @param  roiWidth   Region Of Interest (or source) width
+ * @param  dstHeight  Destination image height
+ * @retval Size in bytes
+ */
+uint32_t ImgResize_DMA2DWorkSize(uint32_t roiWidth, uint32_t dstHeight)
+{
+  return roiWidth * dstHeight * 4;
+}
+
+/**
+ * @brief  Starts a DMA2D bilinear resize (two interrupt-driven passes of line
+ *         blends: vertical into the ARGB8888 work buffer, then horizontal into
+ *         the destination). Source and destination must be RGB565, RGB888 or
+ *         ARGB8888, in the same format. The caller cleans the source from the
+ *         D-Cache beforehand, and keeps the DMA2D for this resize until the
+ *         callback, which runs in the DMA2D interrupt
+ *         (see ImgResize_DMA2D_IRQHandler()).
+ * @param  imgSrc    Source image
+ * @param  imgDst    Destination image
+ * @param  roi       Region Of Interest (at least 2x2), NULL for the whole image
+ * @param  pWork     Work buffer, ImgResize_DMA2DWorkSize() bytes, 4-byte aligned
+ * @param  callback  Completion callback, NULL if unused
+ * @param  pContext  Callback argument
+ * @retval IMG_OK if started, IMG_ERROR_FORMAT or IMG_ERROR_SIZE if not
+ *         supported, IMG_ERROR if the DMA2D is busy (resize in progress, or
+ *         ImgResize_DMA2DAvailable() false)
+ */
+imgstatus_t ImgResize_DMA2D(Image_t *imgSrc, Image_t *imgDst, ImgRect_t *roi,
+                            uint32_t *pWork, ImgResizeCallback_t callback,
+                            void *pContext)
+{
+  IMG_ASSERT(imgSrc->pData != NULL);
+  IMG_ASSERT(imgDst->pData != NULL);
+  IMG_ASSERT(pWork != NULL);
+  IMG_ASSERT(roi == NULL || roi->x0 + roi->width <= imgSrc->width);
+  IMG_ASSERT(roi == NULL || roi->y0 + roi->height <= imgSrc->height);
+
+  const uint32_t pixel_size = IMG_BYTES_PER_PX(imgSrc->format);
+  const uint32_t color_mode = Resize_DMA2DColorMode(imgSrc->format);
+  RESIZE_InitTypedef resize;
+
+  if ((imgSrc->format != imgDst->format) || (color_mode == UINT32_MAX))
+  {
+    return IMG_ERROR_FORMAT;
+  }
+
+  resize.SourceX = (roi != NULL) ? roi->x0 : 0;
+  resize.SourceY = (roi != NULL) ? roi->y0 : 0;
+  resize.SourceWidth = (roi != NULL) ? roi->width : imgSrc->width;
+  resize.SourceHeight = (roi != NULL) ? roi->height : imgSrc->height;
+  if ((resize.SourceWidth < 2) || (resize.SourceHeight < 2) ||
+      (resize.SourceWidth > IMG_DMA2D_RESIZE_MAX_SIZE) ||
+      (resize.SourceHeight > IMG_DMA2D_RESIZE_MAX_SIZE) ||
+      (IMG_STRIDE(imgSrc) % pixel_size != 0) ||
+      (IMG_STRIDE(imgDst) % pixel_size != 0))
+  {
+    return IMG_ERROR_SIZE;
   }
+  resize.SourceBaseAddress = imgSrc->pData;
+  resize.SourcePitch = IMG_STRIDE(imgSrc) / pixel_size;
+  resize.SourceColorMode = color_mode;
+  resize.OutputBaseAddress = imgDst->pData;
+  resize.OutputPitch = IMG_STRIDE(imgDst) / pixel_size;
+  resize.OutputColorMode = color_mode; /* Output and input modes share their values */
+  resize.OutputX = 0;
+  resize.OutputY = 0;
+  resize.OutputWidth = imgDst->width;
+  resize.OutputHeight = imgDst->height;
+  resize.WorkBuffer = pWork;
 
+  /* The DMA2D interrupt goes to the resize from its start: no interrupt driven
+   * DMA2D transfer may be running, nor start in between */
+  const uint32_t primask = __get_PRIMASK();
+  imgstatus_t status = IMG_ERROR;
+
+  __disable_irq();
+  if (!ImgResize_DMA2DBusy() && ImgResize_DMA2DAvailable())
+  {
+    dma2d_resize_callback = callback;
+    dma2d_resize_context = pContext;
+    if (D2D_Resize_Setup(&resize) == D2D_STAGE_SETUP_DONE)
+    {
+      status = IMG_OK;
+    }
+  }
+  __set_PRIMASK(primask);
+  return status;
+}
+
+/**
+ * @brief  Tells whether a DMA2D resize is in progress.
+ * @retval 1 if busy, else 0
+ */
+int ImgResize_DMA2DBusy(void)
+{
+  return D2D_Resize_Stage() != D2D_STAGE_IDLE;
+}
+
+/**
+ * @brief  Tells whether the other users of the DMA2D let a resize start. The
+ *         DMA2D Transfer Complete of a transfer they run from interrupts would
+ *         be taken by the resize, so the application overrides this function
+ *         when it has such transfers (e.g. a DMA2D job queue). Called with the
+ *         interrupts disabled.
+ * @retval 1 if no other DMA2D transfer is in progress, else 0
+ */
+__weak int ImgResize_DMA2DAvailable(void)
+{
+  return 1;
+}
+
+/**
+ * @brief  DMA2D interrupt handler of the DMA2D resize, to be called first from
+ *         DMA2D_IRQHandler().
+ * @retval 1 if the interrupt belonged to a resize, 0 if it is for another
+ *         DMA2D user
+ */
+int ImgResize_DMA2D_IRQHandler(void)
+{
+  if (!ImgResize_DMA2DBusy())
+  {
+    return 0;
+  }
+  D2D_DMA2D_IRQHandler();
+  return 1;
+}
+
+/**
+ * @brief  D2D resize completion, forwarded to the ImgResize_DMA2D() callback.
+ * @param  D2D_Stage  D2D_STAGE_DONE or D2D_STAGE_ERROR
+ * @retval None
+ */
+void D2D_Resize_Callback(D2D_Stage_Typedef D2D_Stage)
+{
+  if (dma2d_resize_callback != NULL)
+  {
+    dma2d_resize_callback((D2D_Stage == D2D_STAGE_DONE) ? IMG_OK : IMG_ERROR,
+                          dma2d_resize_context);
+  }
+}
+
+/**
+* @brief  Returns the DMA2D color mode of a pixel format
+* @param  format       Pixel format
+* @retval uint32_t     DMA2D input (and output) color mode, UINT32_MAX if none
+*/
+static uint32_t Resize_DMA2DColorMode(pxfmt_t format)
+{
+  switch (format)
+  {
+    case PXFMT_ARGB8888:
+      return DMA2D_INPUT_ARGB8888;
+    case PXFMT_RGB888:
+      return DMA2D_INPUT_RGB888;
+    case PXFMT_RGB565:
+      return DMA2D_INPUT_RGB565;
+    default:
+      return UINT32_MAX;
+  }
+}
+
+#endif /* DMA2D */
+
+/**
+* @brief  Maps the bilinear tables on the workspace buffer
+* @param  ws           Workspace
+* @param  dstW         Destination image width
+* @param  dstH         Destination image height
+* @param  tables       Tables to map
+* @retval void         None
+*/
+static void BilinearTables_Map(ImgResizeWs_t *ws, uint32_t dstW, uint32_t dstH,
+                               BilinearTables_t *tables)
+{
+  uint8_t *p = (uint8_t *) ws->pBuffer;
+
+  tables->yOfs0 = (uint32_t *) p;
+  p += dstH * sizeof(uint32_t);
+  tables->yOfs1 = (uint32_t *) p;
+  p += dstH * sizeof(uint32_t);
+  tables->xOfs0 = (uint16_t *) p;
+  p += dstW * sizeof(uint16_t);
+  tables->xOfs1 = (uint16_t *) p;
+  p += dstW * sizeof(uint16_t);
+  tables->xW = (uint16_t *) p;
+  p += dstW * sizeof(uint16_t);
+  tables->yW = (uint16_t *) p;
+}
+
+/**
+* @brief  Computes the bilinear source offsets and weights of a geometry
+* @param  tables       Tables to fill
+* @param  geo          Resize geometry
+* @retval void         None
+*/
+static void BilinearTables_Build(BilinearTables_t *tables, ResizeGeometry_t *geo)
+{
+  const uint32_t x_ratio = (geo->roiW << 16) / geo->dstW;
+  const uint32_t y_ratio = (geo->roiH << 16) / geo->dstH;
+
+  for (uint32_t x = 0; x < geo->dstW; x++)
+  {
+    uint32_t sx = x * x_ratio;
+    uint32_t x0 = sx >> 16;
+    uint32_t x1 = (x0 + 1 < geo->roiW) ? x0 + 1 : x0;
+    tables->xOfs0[x] = (uint16_t) ((geo->roiX + x0) * geo->pixelSize);
+    tables->xOfs1[x] = (uint16_t) ((geo->roiX + x1) * geo->pixelSize);
+    tables->xW[x] = (uint16_t) ((sx >> 8) & 0xffu);
+  }
+
+  for (uint32_t y = 0; y < geo->dstH; y++)
+  {
+    uint32_t sy = y * y_ratio;
+    uint32_t y0 = sy >> 16;
+    uint32_t y1 = (y0 + 1 < geo->roiH) ? y0 + 1 : y0;
+    tables->yOfs0[y] = (geo->roiY + y0) * geo->srcStride;
+    tables->yOfs1[y] = (geo->roiY + y1) * geo->srcStride;
+    tables->yW[y] = (uint16_t) ((sy >> 8) & 0xffu);
+  }
+}
+
+/* Q8 linear interpolation of one component, w being the share of b */
+#define LERP_Q8(a, b, w)  ((((a) * (256 - (w))) + ((b) * (w)) + 128) >> 8)
+
+/* Q8 linear interpolation of the four bytes of a word, two at a time: each
+ * 16-bit lane holds at most 255 * 256 + 128, so lanes never overflow. */
+static inline uint32_t lerp_q8_x4(uint32_t a, uint32_t b, uint32_t w)
+{
+  const uint32_t iw = 256 - w;
+  uint32_t lo = ((a & 0x00ff00ffu) * iw + (b & 0x00ff00ffu) * w + 0x00800080u);
+  uint32_t hi = (((a >> 8) & 0x00ff00ffu) * iw + ((b >> 8) & 0x00ff00ffu) * w +
+                 0x00800080u);
+  return ((lo >> 8) & 0x00ff00ffu) | (hi & 0xff00ff00u);
+}
+
+static void BilinearRow_1(const uint8_t *pL0, const uint8_t *pL1, uint32_t fy,
+                          BilinearTables_t *tables, uint8_t *pOut, uint32_t dstW)
+{
+  for (uint32_t x = 0; x < dstW; x++)
+  {
+    const uint32_t o0 = tables->xOfs0[x];
+    const uint32_t o1 = tables->xOfs1[x];
+    const uint32_t fx = tables->xW[x];
+    uint32_t top = LERP_Q8(pL0[o0], pL0[o1], fx);
+    uint32_t bot = LERP_Q8(pL1[o0], pL1[o1], fx);
+    *pOut++ = (uint8_t) LERP_Q8(top, bot, fy);
+  }
+}
+
+/* One component of the bilinear RGB565 pixel, in place */
+#define BILINEAR_RGB565_COMP(shift, mask)                                     \
+  (LERP_Q8(LERP_Q8((p00 >> (shift)) & (mask), (p01 >> (shift)) & (mask), fx),  \
+           LERP_Q8((p10 >> (shift)) & (mask), (p11 >> (shift)) & (mask), fx),  \
+           fy) << (shift))
+
+static void BilinearRow_RGB565(const uint8_t *pL0, const uint8_t *pL1,
+                               uint32_t fy, BilinearTables_t *tables,
+                               uint16_t *pOut, uint32_t dstW)
+{
+  for (uint32_t x = 0; x < dstW; x++)
+  {
+    const uint32_t o0 = tables->xOfs0[x];
+    const uint32_t o1 = tables->xOfs1[x];
+    const uint32_t fx = tables->xW[x];
+    const uint32_t p00 = *(const uint16_t *) (pL0 + o0);
+    const uint32_t p01 = *(const uint16_t *) (pL0 + o1);
+    const uint32_t p10 = *(const uint16_t *) (pL1 + o0);
+    const uint32_t p11 = *(const uint16_t *) (pL1 + o1);
+    /* R:5 G:6 B:5 components interpolated separately */
+    uint32_t pixel = BILINEAR_RGB565_COMP(11, 0x1fu) |
+                     BILINEAR_RGB565_COMP(5, 0x3fu) |
+                     BILINEAR_RGB565_COMP(0, 0x1fu);
+    *pOut++ = (uint16_t) pixel;
+  }
+}
+
+static void BilinearRow_3(const uint8_t *pL0, const uint8_t *pL1, uint32_t fy,
+                          BilinearTables_t *tables, uint8_t *pOut, uint32_t dstW)
+{
+  for (uint32_t x = 0; x < dstW; x++)
+  {
+    const uint8_t *p00 = pL0 + tables->xOfs0[x];
+    const uint8_t *p01 = pL0 + tables->xOfs1[x];
+    const uint8_t *p10 = pL1 + tables->xOfs0[x];
+    const uint8_t *p11 = pL1 + tables->xOfs1[x];
+    const uint32_t fx = tables->xW[x];
+    for (uint32_t ch = 0; ch < 3; ch++)
+    {
+      uint32_t top = LERP_Q8(p00[ch], p01[ch], fx);
+      uint32_t bot = LERP_Q8(p10[ch], p11[ch], fx);
+      *pOut++ = (uint8_t) LERP_Q8(top, bot, fy);
+    }
+  }
+}
+
+static void BilinearRow_4(const uint8_t *pL0, const uint8_t *pL1, uint32_t fy,
+                          BilinearTables_t *tables, uint32_t *pOut,
+                          uint32_t dstW)
+{
+  for (uint32_t x = 0; x < dstW; x++)
+  {
+    const uint32_t o0 = tables->xOfs0[x];
+    const uint32_t o1 = tables->xOfs1[x];
+    const uint32_t fx = tables->xW[x];
+    uint32_t top = lerp_q8_x4(*(const uint32_t *) (pL0 + o0),
+                              *(const uint32_t *) (pL0 + o1), fx);
+    uint32_t bot = lerp_q8_x4(*(const uint32_t *) (pL1 + o0),
+                              *(const uint32_t *) (pL1 + o1), fx);
+    *pOut++ = lerp_q8_x4(top, bot, fy);
+  }
+}
+
+/**
+* @brief  Performs bilinear resizing in Q8 fixed point from precomputed tables
+* @param  srcImage     Pointer to source image buffer
+* @param  tables       Source offsets and weights
+* @param  format       Pixel format
+* @param  pixelSize    Number of bytes per pixel
+* @param  dstImage     Pointer to destination image buffer
+* @param  dstW         Destination image width
+* @param  dstH         Destination image height
+* @param  dstStride    Destination image line pitch in bytes
+* @retval void         None
+*/
+static void ImageResize_BilinearQ8(uint8_t *srcImage, BilinearTables_t *tables,
+                                   pxfmt_t format, uint32_t pixelSize,
+                                   uint8_t *dstImage, uint32_t dstW,
+                                   uint32_t dstH, uint32_t dstStride)
+{
+  IMG_ASSERT(pixelSize != 4 || ((uintptr_t) srcImage & 0x3u) == 0);
+  IMG_ASSERT(pixelSize != 4 || ((uintptr_t) dstImage & 0x3u) == 0);
+
+  for (uint32_t y = 0; y < dstH; y++, dstImage += dstStride)
+  {
+    const uint8_t *pL0 = srcImage + tables->yOfs0[y];
+    const uint8_t *pL1 = srcImage + tables->yOfs1[y];
+    const uint32_t fy = tables->yW[y];
+
+    switch (pixelSize)
+    {
+    case 1:
+      BilinearRow_1(pL0, pL1, fy, tables, dstImage, dstW);
+      break;
+
+    case 2:
+      IMG_ASSERT(format == PXFMT_RGB565);
+      BilinearRow_RGB565(pL0, pL1, fy, tables, (uint16_t *) dstImage, dstW);
+      break;
+
+    case 3:
+      BilinearRow_3(pL0, pL1, fy, tables, dstImage, dstW);
+      break;
+
+    case 4:
+      BilinearRow_4(pL0, pL1, fy, tables, (uint32_t *) dstImage, dstW);
+      break;
+
+    default:
+      break;
+    }
+  }
+}
+
+/**
+* @brief  Computes the 4 taps of a bicubic sample: source indexes clamped to
+*         [0, size - 1] and Keys (a = -0.5) weights in Q12 adding up to 1.0
+* @param  pos          Sample position (Q16)
+* @param  size         Number of source samples
+* @param  idx          Source indexes
+* @param  w            Weights
+* @retval void         None
+*/
+static void Bicubic_Taps(uint32_t pos, uint32_t size, uint32_t *idx, int16_t *w)
+{
+  const int32_t i0 = (int32_t) (pos >> 16);
+  const float t = (float) (pos & 0xffffu) / 65536.0f;
+  /* Distance of each tap to the sample */
+  const float d[BICUBIC_TAPS] = {1.0f + t, t, 1.0f - t, 2.0f - t};
+  int32_t sum = 0;
+
+  for (uint32_t k = 0; k < BICUBIC_TAPS; k++)
+  {
+    float x = d[k];
+    float f = (x <= 1.0f) ? ((1.5f * x - 2.5f) * x * x + 1.0f)
+                          : (((-0.5f * x + 2.5f) * x - 4.0f) * x + 2.0f);
+    f *= (float) BICUBIC_ONE;
+    w[k] = (int16_t) ((f >= 0.0f) ? (int32_t) (f + 0.5f)
+                                  : -(int32_t) (-f + 0.5f));
+    sum += w[k];
+
+    int32_t i = i0 - 1 + (int32_t) k;
+    i = (i < 0) ? 0 : i;
+    i = (i > (int32_t) size - 1) ? (int32_t) size - 1 : i;
+    idx[k] = (uint32_t) i;
+  }
+  /* Rounding leftover on the nearest tap, so that flat areas stay flat */
+  w[(t < 0.5f) ? 1 : 2] += (int16_t) (BICUBIC_ONE - sum);
+}
+
+/* Horizontal pass: Q12 weighted sum of 4 components, rounded to Q8 */
+#define BICUBIC_H(c0, c1, c2, c3, w)                                          \
+  (((int32_t) (c0) * (w)[0] + (int32_t) (c1) * (w)[1] +                       \
+    (int32_t) (c2) * (w)[2] + (int32_t) (c3) * (w)[3] + 8) >> 4)
+
+/* Vertical pass: Q12 weighted sum of 4 Q8 values, rounded and clamped */
+static inline uint32_t Bicubic_V(int32_t h0, int32_t h1, int32_t h2, int32_t h3,
+                                 const int16_t *w, int32_t max)
+{
+  int32_t v = (h0 * w[0] + h1 * w[1] + h2 * w[2] + h3 * w[3] + (1 << 19)) >> 20;
+  return (uint32_t) ((v < 0) ? 0 : ((v > max) ? max : v));
+}
+
+/* Component c of a pixel: byte c, or R, G, B field of a RGB565 pixel */
+static inline uint32_t Resize_Comp(const uint8_t *pPixel, pxfmt_t format,
+                                    uint32_t c)
+{
+  if (format == PXFMT_RGB565)
+  {
+    const uint32_t pixel = *(const uint16_t *) pPixel;
+    return (c == 0) ? (pixel >> 11) : ((c == 1) ? ((pixel >> 5) & 0x3fu)
+                                                : (pixel & 0x1fu));
+  }
+  return pPixel[c];
+}
+
+/* Number of components of a pixel */
+#define RESIZE_COMPS(format, pixelSize) \
+  (((format) == PXFMT_RGB565) ? 3 : (pixelSize))
+
+/**
+* @brief  Maps the bicubic tables on the workspace buffer
+* @param  ws           Workspace
+* @param  dstW         Destination image width
+* @param  dstH         Destination image height
+* @param  tables       Tables to map
+* @retval void         None
+*/
+static void BicubicTables_Map(ImgResizeWs_t *ws, uint32_t dstW, uint32_t dstH,
+                              BicubicTables_t *tables)
+{
+  uint8_t *p = (uint8_t *) ws->pBuffer;
+
+  tables->ring = (int32_t *) p;
+  p += BICUBIC_TAPS * dstW * 4 * sizeof(int32_t);
+  tables->ringRow = (int32_t *) p;
+  p += BICUBIC_TAPS * sizeof(int32_t);
+  tables->xOfs = (uint16_t *) p;
+  p += BICUBIC_TAPS * dstW * sizeof(uint16_t);
+  tables->xW = (int16_t *) p;
+  p += BICUBIC_TAPS * dstW * sizeof(int16_t);
+  tables->yRow = (uint16_t *) p;
+  p += BICUBIC_TAPS * dstH * sizeof(uint16_t);
+  tables->yW = (int16_t *) p;
+}
+
+/**
+* @brief  Computes the bicubic source offsets and weights of a geometry
+* @param  tables       Tables to fill
+* @param  geo          Resize geometry
+* @retval void         None
+*/
+static void BicubicTables_Build(BicubicTables_t *tables, ResizeGeometry_t *geo)
+{
+  const uint32_t x_ratio = (geo->roiW << 16) / geo->dstW;
+  const uint32_t y_ratio = (geo->roiH << 16) / geo->dstH;
+  uint32_t idx[BICUBIC_TAPS];
+
+  for (uint32_t x = 0; x < geo->dstW; x++)
+  {
+    Bicubic_Taps(x * x_ratio, geo->roiW, idx, &tables->xW[x * BICUBIC_TAPS]);
+    for (uint32_t k = 0; k < BICUBIC_TAPS; k++)
+    {
+      tables->xOfs[x * BICUBIC_TAPS + k] =
+        (uint16_t) ((geo->roiX + idx[k]) * geo->pixelSize);
+    }
+  }
+
+  for (uint32_t y = 0; y < geo->dstH; y++)
+  {
+    Bicubic_Taps(y * y_ratio, geo->roiH, idx, &tables->yW[y * BICUBIC_TAPS]);
+    for (uint32_t k = 0; k < BICUBIC_TAPS; k++)
+    {
+      tables->yRow[y * BICUBIC_TAPS + k] = (uint16_t) idx[k];
+    }
+  }
+}
+
+/**
+* @brief  Horizontal bicubic pass of one source line
+* @param  pLine        Source line
+* @param  tables       Bicubic tables
+* @param  format       Pixel format
+* @param  comps        Number of components per pixel
+* @param  pOut         Filtered line, comps Q8 values per destination pixel
+* @param  dstW         Destination image width
+* @retval void         None
+*/
+static void BicubicLine_H(const uint8_t *pLine, BicubicTables_t *tables,
+                          pxfmt_t format, uint32_t comps, int32_t *pOut,
+                          uint32_t dstW)
+{
+  const uint16_t *ofs = tables->xOfs;
+  const int16_t *w = tables->xW;
+
+  if (format == PXFMT_RGB565)
+  {
+    for (uint32_t x = 0; x < dstW; x++, ofs += BICUBIC_TAPS, w += BICUBIC_TAPS)
+    {
+      const uint32_t p0 = *(const uint16_t *) (pLine + ofs[0]);
+      const uint32_t p1 = *(const uint16_t *) (pLine + ofs[1]);
+      const uint32_t p2 = *(const uint16_t *) (pLine + ofs[2]);
+      const uint32_t p3 = *(const uint16_t *) (pLine + ofs[3]);
+      *pOut++ = BICUBIC_H(p0 >> 11, p1 >> 11, p2 >> 11, p3 >> 11, w);
+      *pOut++ = BICUBIC_H((p0 >> 5) & 0x3fu, (p1 >> 5) & 0x3fu,
+                          (p2 >> 5) & 0x3fu, (p3 >> 5) & 0x3fu, w);
+      *pOut++ = BICUBIC_H(p0 & 0x1fu, p1 & 0x1fu, p2 & 0x1fu, p3 & 0x1fu, w);
+    }
+  }
+  else if (comps == 1)
+  {
+    for (uint32_t x = 0; x < dstW; x++, ofs += BICUBIC_TAPS, w += BICUBIC_TAPS)
+    {
+      *pOut++ = BICUBIC_H(pLine[ofs[0]], pLine[ofs[1]], pLine[ofs[2]],
+                          pLine[ofs[3]], w);
+    }
+  }
+  else
+  {
+    for (uint32_t x = 0; x < dstW; x++, ofs += BICUBIC_TAPS, w += BICUBIC_TAPS)
+    {
+      const uint8_t *p0 = pLine + ofs[0];
+      const uint8_t *p1 = pLine + ofs[1];
+      const uint8_t *p2 = pLine + ofs[2];
+      const uint8_t *p3 = pLine + ofs[3];
+      for (uint32_t c = 0; c < comps; c++)
+      {
+        *pOut++ = BICUBIC_H(p0[c], p1[c], p2[c], p3[c], w);
+      }
+    }
+  }
+}
+
+/**
+* @brief  Performs separable bicubic resizing in Q12 fixed point from
+*         precomputed tables, through a ring of 4 filtered source lines
+* @param  srcImage     Pointer to source image buffer
+* @param  tables       Source offsets, weights and line ring
+* @param  geo          Resize geometry
+* @param  dstImage     Pointer to destination image buffer
+* @param  dstStride    Destination image line pitch in bytes
+* @retval void         None
+*/
+static void ImageResize_BicubicQ12(uint8_t *srcImage, BicubicTables_t *tables,
+                                   ResizeGeometry_t *geo, uint8_t *dstImage,
+                                   uint32_t dstStride)
+{
+  const pxfmt_t format = (pxfmt_t) geo->format;
+  const uint32_t comps = RESIZE_COMPS(format, geo->pixelSize);
+  const uint32_t line_len = geo->dstW * comps;
+  const uint32_t ring_len = geo->dstW * 4;
+
+  /* Source data changes from call to call, start with an empty ring */
+  for (uint32_t k = 0; k < BICUBIC_TAPS; k++)
+  {
+    tables->ringRow[k] = -1;
+  }
+
+  for (uint32_t y = 0; y < geo->dstH; y++, dstImage += dstStride)
+  {
+    const uint16_t *rows = &tables->yRow[y * BICUBIC_TAPS];
+    const int16_t *w = &tables->yW[y * BICUBIC_TAPS];
+    const int32_t *h[BICUBIC_TAPS];
+
+    /* Consecutive source lines never share a ring entry */
+    for (uint32_t k = 0; k < BICUBIC_TAPS; k++)
+    {
+      const uint32_t slot = rows[k] % BICUBIC_TAPS;
+      int32_t *pRing = tables->ring + slot * ring_len;
+      if (tables->ringRow[slot] != (int32_t) rows[k])
+      {
+        BicubicLine_H(srcImage + (geo->roiY + rows[k]) * geo->srcStride,
+                      tables, format, comps, pRing, geo->dstW);
+        tables->ringRow[slot] = (int32_t) rows[k];
+      }
+      h[k] = pRing;
+    }
+
+    if (format == PXFMT_RGB565)
+    {
+      uint16_t *pOut = (uint16_t *) dstImage;
+      for (uint32_t i = 0; i < line_len; i += 3)
+      {
+        uint32_t r = Bicubic_V(h[0][i], h[1][i], h[2][i], h[3][i], w, 31);
+        uint32_t g = Bicubic_V(h[0][i + 1], h[1][i + 1], h[2][i + 1],
+                               h[3][i + 1], w, 63);
+        uint32_t b = Bicubic_V(h[0][i + 2], h[1][i + 2], h[2][i + 2],
+                               h[3][i + 2], w, 31);
+        *pOut++ = (uint16_t) ((r << 11) | (g << 5) | b);
+      }
+    }
+    else
+    {
+      uint8_t *pOut = dstImage;
+      for (uint32_t i = 0; i < line_len; i++)
+      {
+        *pOut++ = (uint8_t) Bicubic_V(h[0][i], h[1][i], h[2][i], h[3][i], w,
+                                      255);
+      }
+    }
+  }
+}
+
+/* Overlap of source sample i and destination sample o, both scaled to a
+ * common grid: source samples are dstN wide, destination ones roiN wide. */
+static inline uint32_t Area_Weight(uint32_t i, uint32_t o, uint32_t roiN,
+                                   uint32_t dstN)
+{
+  const uint32_t s0 = i * dstN;
+  const uint32_t d0 = o * roiN;
+  const uint32_t start = (s0 > d0) ? s0 : d0;
+  const uint32_t end = (s0 + dstN < d0 + roiN) ? s0 + dstN : d0 + roiN;
+  return end - start;
+}
+
+/* First and past-the-last source samples covered by destination sample o */
+#define AREA_FIRST(o, roiN, dstN)  (((o) * (roiN)) / (dstN))
+#define AREA_END(o, roiN, dstN)    ((((o) + 1) * (roiN) + (dstN) - 1) / (dstN))
+
+/* Writes a destination pixel from its components */
+static inline void Area_Store(uint8_t *pOut, pxfmt_t format, uint32_t comps,
+                              const uint32_t *value)
+{
+  if (format == PXFMT_RGB565)
+  {
+    *(uint16_t *) pOut = (uint16_t) ((value[0] << 11) | (value[1] << 5) |
+                                     value[2]);
+  }
+  else
+  {
+    for (uint32_t c = 0; c < comps; c++)
+    {
+      pOut[c] = (uint8_t) value[c];
+    }
+  }
+}
+
+/**
+* @brief  Performs image (or selected Region Of Interest) resizing using area
+*         averaging, one destination pixel at a time. Each destination pixel
+*         gets the rounded mean of the source area it covers, weighted by the
+*         exact (integer) overlap. Gives the same result as the workspace
+*         path of ImgResizeCropEx().
+* @param  srcImage     Pointer to source image buffer
+* @param  srcStride    Source image line pitch in bytes
+* @param  format       Pixel format
+* @param  roiX         Region Of Interest x starting location
+* @param  roiY         Region Of Interest y starting location
+* @param  roiW         Region Of Interest width
+* @param  roiH         Region Of Interest height
+* @param  dstImage     Pointer to destination image buffer
+* @param  dstW         Destination image width
+* @param  dstH         Destination image height
+* @param  dstStride    Destination image line pitch in bytes
+* @retval void         None
+*/
+static void ImageResize_Area(uint8_t *srcImage, uint32_t srcStride,
+                             pxfmt_t format, uint32_t roiX, uint32_t roiY,
+                             uint32_t roiW, uint32_t roiH, uint8_t *dstImage,
+                             uint32_t dstW, uint32_t dstH, uint32_t dstStride)
+{
+  const uint32_t pixel_size = IMG_BYTES_PER_PX(format);
+  const uint32_t comps = RESIZE_COMPS(format, pixel_size);
+  const uint32_t area = roiW * roiH;
+
+  srcImage += roiY * srcStride + roiX * pixel_size;
+
+  for (uint32_t y = 0; y < dstH; y++, dstImage += dstStride)
+  {
+    const uint32_t j_end = AREA_END(y, roiH, dstH);
+
+    for (uint32_t x = 0; x < dstW; x++)
+    {
+      const uint32_t i_end = AREA_END(x, roiW, dstW);
+      uint32_t value[4] = {0, 0, 0, 0};
+
+      for (uint32_t j = AREA_FIRST(y, roiH, dstH); j < j_end; j++)
+      {
+        const uint8_t *pLine = srcImage + j * srcStride;
+        const uint32_t wy = Area_Weight(j, y, roiH, dstH);
+        for (uint32_t i = AREA_FIRST(x, roiW, dstW); i < i_end; i++)
+        {
+          const uint32_t w = wy * Area_Weight(i, x, roiW, dstW);
+          for (uint32_t c = 0; c < comps; c++)
+          {
+            value[c] += w * Resize_Comp(pLine + i * pixel_size, format, c);
+          }
+        }
+      }
+      for (uint32_t c = 0; c < comps; c++)
+      {
+        value[c] = (value[c] + area / 2) / area;
+      }
+      Area_Store(dstImage + x * pixel_size, format, comps, value);
+    }
+  }
+}
+
+/**
+* @brief  Adds k x 1 source pixel sums to a line of 16-bit accumulators, for
+*         k x k integer reductions
+* @param  pIn          Source line, at the ROI left edge
+* @param  format       Pixel format
+* @param  pixelSize    Number of bytes per pixel
+* @param  k            Reduction factor
+* @param  acc          Accumulators, one per destination component
+* @param  dstW         Destination image width
+* @retval void         None
+*/
+static void AreaLine_SumK(const uint8_t *pIn, pxfmt_t format,
+                          uint32_t pixelSize, uint32_t k, uint16_t *acc,
+                          uint32_t dstW)
+{
+  const uint32_t comps = RESIZE_COMPS(format, pixelSize);
+  uint32_t x = 0;
+
+#if IMG_USE_SIMD
+  /* Two 16-bit accumulators per word: sums stay below 255 * 16 */
+  uint32_t *acc32 = (uint32_t *) acc;
+
+  if ((pixelSize == 1) && (k == 2))
+  {
+    for (; x + 2 <= dstW; x += 2, pIn += 4)
+    {
+      uint32_t w = __UNALIGNED_UINT32(pIn);
+      acc32[x / 2] = __UXTAB16(__UXTAB16(acc32[x / 2], w), __ROR(w, 8));
+    }
+  }
+  else if ((pixelSize == 1) && (k == 4))
+  {
+    for (; x + 2 <= dstW; x += 2, pIn += 8)
+    {
+      uint32_t w0 = __UNALIGNED_UINT32(pIn);
+      uint32_t w1 = __UNALIGNED_UINT32(pIn + 4);
+      uint32_t s0 = __UXTAB16(__UXTB16(w0), __ROR(w0, 8)); /* p2+p3 | p0+p1 */
+      uint32_t s1 = __UXTAB16(__UXTB16(w1), __ROR(w1, 8)); /* p6+p7 | p4+p5 */
+      acc32[x / 2] += __PKHBT(s0, s1, 16) + __PKHTB(s1, s0, 16);
+    }
+  }
+  else if (pixelSize == 4)
+  {
+    for (; x < dstW; x++)
+    {
+      uint32_t even = 0; /* Components 2 | 0 */
+      uint32_t odd = 0;  /* Components 3 | 1 */
+      for (uint32_t i = 0; i < k; i++, pIn += 4)
+      {
+        uint32_t w = __UNALIGNED_UINT32(pIn);
+        even = __UXTAB16(even, w);
+        odd = __UXTAB16(odd, __ROR(w, 8));
+      }
+      acc32[2 * x] += __PKHBT(even, odd, 16);
+      acc32[2 * x + 1] += __PKHTB(odd, even, 16);
+    }
+  }
+#endif /* IMG_USE_SIMD */
+
+  for (; x < dstW; x++)
+  {
+    for (uint32_t c = 0; c < comps; c++)
+    {
+      uint32_t sum = 0;
+      for (uint32_t i = 0; i < k; i++)
+      {
+        sum += Resize_Comp(pIn + i * pixelSize, format, c);
+      }
+      acc[x * comps + c] += (uint16_t) sum;
+    }
+    pIn += k * pixelSize;
+  }
+}
+
+/**
+* @brief  Adds the weighted horizontal box sums of one source line to a line of
+*         32-bit accumulators, for any reduction (or enlargement) ratio
+* @param  pIn          Source line, at the ROI left edge
+* @param  format       Pixel format
+* @param  pixelSize    Number of bytes per pixel
+* @param  wy           Vertical weight of the line
+* @param  acc          Accumulators, one per destination component
+* @param  roiW         Region Of Interest width
+* @param  dstW         Destination image width
+* @retval void         None
+*/
+static void AreaLine_Sum(const uint8_t *pIn, pxfmt_t format, uint32_t pixelSize,
+                         uint32_t wy, uint32_t *acc, uint32_t roiW,
+                         uint32_t dstW)
+{
+  const uint32_t comps = RESIZE_COMPS(format, pixelSize);
+
+  for (uint32_t x = 0; x < dstW; x++, acc += comps)
+  {
+    const uint32_t i_end = AREA_END(x, roiW, dstW);
+    for (uint32_t i = AREA_FIRST(x, roiW, dstW); i < i_end; i++)
+    {
+      const uint32_t w = wy * Area_Weight(i, x, roiW, dstW);
+      for (uint32_t c = 0; c < comps; c++)
+      {
+        acc[c] += w * Resize_Comp(pIn + i * pixelSize, format, c);
+      }
+    }
+  }
+}
+
+/**
+* @brief  Performs area averaging resizing with line accumulators. 2x and 4x
+*         integer reductions sum k x k blocks in 16-bit accumulators (packed
+*         adds on cores with the DSP extension), other ratios use the exact
+*         integer overlap weights.
+* @param  srcImage     Pointer to source image buffer
+* @param  srcStride    Source image line pitch in bytes
+* @param  format       Pixel format
+* @param  roiX         Region Of Interest x starting location
+* @param  roiY         Region Of Interest y starting location
+* @param  roiW         Region Of Interest width
+* @param  roiH         Region Of Interest height
+* @param  dstImage     Pointer to destination image buffer
+* @param  dstW         Destination image width
+* @param  dstH         Destination image height
+* @param  dstStride    Destination image line pitch in bytes
+* @param  acc          Accumulators, dstW * 4 words
+* @retval void         None
+*/
+static void ImageResize_AreaWs(uint8_t *srcImage, uint32_t srcStride,
+                               pxfmt_t format, uint32_t roiX, uint32_t roiY,
+                               uint32_t roiW, uint32_t roiH, uint8_t *dstImage,
+                               uint32_t dstW, uint32_t dstH, uint32_t dstStride,
+                               uint32_t *acc)
+{
+  const uint32_t pixel_size = IMG_BYTES_PER_PX(format);
+  const uint32_t comps = RESIZE_COMPS(format, pixel_size);
+  const uint32_t line_len = dstW * comps;
+  uint32_t k = 0;
+
+  if ((roiW == 2 * dstW) && (roiH == 2 * dstH))
+  {
+    k = 2;
+  }
+  else if ((roiW == 4 * dstW) && (roiH == 4 * dstH))
+  {
+    k = 4;
+  }
+
+  srcImage += roiY * srcStride + roiX * pixel_size;
+
+  for (uint32_t y = 0; y < dstH; y++, dstImage += dstStride)
+  {
+    uint32_t value[4];
+
+    if (k != 0)
+    {
+      /* k x k blocks: (sum + k * k / 2) / (k * k) */
+      uint16_t *acc16 = (uint16_t *) acc;
+      const uint32_t shift = (k == 2) ? 2 : 4;
+
+      memset(acc16, 0, line_len * sizeof(uint16_t));
+      for (uint32_t j = 0; j < k; j++)
+      {
+        AreaLine_SumK(srcImage + (y * k + j) * srcStride, format, pixel_size,
+                      k, acc16, dstW);
+      }
+      for (uint32_t x = 0; x < dstW; x++, acc16 += comps)
+      {
+        for (uint32_t c = 0; c < comps; c++)
+        {
+          value[c] = ((uint32_t) acc16[c] + (1u << (shift - 1))) >> shift;
+        }
+        Area_Store(dstImage + x * pixel_size, format, comps, value);
+      }
+    }
+    else
+    {
+      const uint32_t area = roiW * roiH;
+      const uint32_t j_end = AREA_END(y, roiH, dstH);
+      const uint32_t *pAcc = acc;
+
+      memset(acc, 0, line_len * sizeof(uint32_t));
+      for (uint32_t j = AREA_FIRST(y, roiH, dstH); j < j_end; j++)
+      {
+        AreaLine_Sum(srcImage + j * srcStride, format, pixel_size,
+                     Area_Weight(j, y, roiH, dstH), acc, roiW, dstW);
+      }
+      for (uint32_t x = 0; x < dstW; x++, pAcc += comps)
+      {
+        for (uint32_t c = 0; c < comps; c++)
+        {
+          value[c] = (pAcc[c] + area / 2) / area;
+        }
+        Area_Store(dstImage + x * pixel_size, format, comps, value);
+      }
+    }
+  }
 }
 
 /**
@@ -80,6 +1322,7 @@ void ImgResizeCrop(Image_t *imgSrc, Image_t *imgDst, ImgRect_t* roi, intrpl_t in
 * @param  srcImage     Pointer to source image buffer
 * @param  srcW         Source image width
 * @param  srcH         Source image height
+* @param  srcStride    Source image line pitch in bytes
 * @param  pixelSize    Number of bytes per pixel
 * @param  roiX         Region Of Interest x starting location
 * @param  roiY         Region Of Interest y starting location
@@ -88,6 +1331,7 @@ void ImgResizeCrop(Image_t *imgSrc, Image_t *imgDst, ImgRect_t* roi, intrpl_t in
 * @param  dstImage     Pointer to destination image buffer
 * @param  dstW         Destination image width
 * @param  dstH         Destination image height
+* @param  dstStride    Destination image line pitch in bytes
 * @retval void         None
 */
 #if 0
@@ -116,15 +1360,17 @@ static void ImageResize_NearestNeighbor(uint8_t *srcImage, uint32_t srcW, uint32
 }
 #else
 static void ImageResize_NearestNeighbor(uint8_t *pIn, uint32_t srcW, uint32_t srcH,
-                                        uint32_t pixelSize, uint32_t roiX, uint32_t roiY,
-                                        uint32_t roiW, uint32_t roiH, uint8_t *pOut,
-                                        uint32_t dstW, uint32_t dstH)
+                                        uint32_t srcStride, uint32_t pixelSize,
+                                        uint32_t roiX, uint32_t roiY,
+                                        uint32_t roiW, uint32_t roiH, uint8_t *dstImage,
+                                        uint32_t dstW, uint32_t dstH, uint32_t dstStride)
 {
   const uint32_t x_ratio = (uint32_t) ((roiW << 16) / dstW) + 1;
   const uint32_t y_ratio = (uint32_t) ((roiH << 16) / dstH) + 1;
 
   for (uint32_t y = 0; y < dstH; y++) {
-    uint32_t src_y = (((y * y_ratio) >> 16) + roiY) * srcW * pixelSize;
+    uint32_t src_y = (((y * y_ratio) >> 16) + roiY) * srcStride;
+    uint8_t *pOut = dstImage + y * dstStride;
 
     for (uint32_t x = 0; x < dstW; x++) {
       uint32_t src_xy = (((x * x_ratio) >> 16) + roiX) * pixelSize + src_y;
@@ -138,71 +1384,3 @@ static void ImageResize_NearestNeighbor(uint8_t *pIn, uint32_t srcW, uint32_t sr
 }
 #endif
 
-
-void ImageResize_Bilinear(uint8_t *srcImage, uint32_t srcW, uint32_t srcH,
-                          uint32_t pixelSize, uint32_t roiX, uint32_t roiY,
-                          uint32_t roiW, uint32_t roiH,  uint8_t *dstImage,
-                          uint32_t dstW, uint32_t dstH)
-{
-  int32_t srcStride;
-  float widthRatio;
-  float heightRatio;
-
-  int32_t maxWidth;
-  int32_t maxHeight;
-
-  float srcX, srcY, dX1, dY1, dX2, dY2;
-  int32_t dstX1, srcY1, dstX2, srcY2;
-
-  uint8_t *tmp1, *tmp2;
-  uint8_t *p1, *p2, *p3, *p4;
-
-  int32_t offset1;
-  int32_t offset2;
-
-  srcStride = pixelSize * srcW;
-
-  widthRatio = ((roiW ? roiW : srcW) / (float) dstW);
-  heightRatio = ((roiH ? roiH : srcH) / (float) dstH);
-
-  /* Get horizontal and vertical limits. */
-  maxWidth = (roiW ? roiW : srcW) - 1;
-  maxHeight = (roiH ? roiH : srcH) - 1;
-
-  for (int32_t y = 0; y < dstH; y++)
-  {
-    /* Get Y from source. */
-    srcY = ((float) y * heightRatio) + roiY;
-    srcY1 = (int32_t) srcY;
-    srcY2 = (srcY1 == maxHeight) ? srcY1 : srcY1 + 1;
-    dY1 = srcY - (float) srcY1;
-    dY2 = 1.0f - dY1;
-
-    /* Calculates the pointers to the two needed lines of the source. */
-    tmp1 = srcImage + srcY1 * srcStride;
-    tmp2 = srcImage + srcY2 * srcStride;
-
-    for (int32_t x = 0; x < dstW; x++)
-    {
-      /* Get X from source. */
-      srcX = x * widthRatio + roiX;
-      dstX1 = (int32_t) srcX;
-      dstX2 = (dstX1 == maxWidth) ? dstX1 : dstX1 + 1;
-      dX1 = srcX - /*(float32)*/dstX1;
-      dX2 = 1.0f - dX1;
-
-      /* Calculates the four points (p1,p2, p3, p4) of the source. */
-      offset1 = dstX1 * pixelSize;
-      offset2 = dstX2 * pixelSize;
-      p1 = tmp1 + offset1;
-      p2 = tmp1 + offset2;
-      p3 = tmp2 + offset1;
-      p4 = tmp2 + offset2;
-      /* For each channel, interpolate the four points. */
-      for (int32_t ch = 0; ch < pixelSize; ch++, dstImage++, p1++, p2++, p3++, p4++)
-      {
-        *dstImage = (uint8_t)(dY2 * (dX2 * (*p1) + dX1 * (*p2)) + dY1 * (dX2 * (*p3) + dX1 * (*p4)));
-      }
-    }
-  }
-}
@@ -0,0 +1,253 @@
+/*******************************************************************************
+ * @file           : stm32_img_tensor.c
+ * @brief          : Tensor module providing neural network input preprocessing
+ *                   (resize, crop, color conversion and normalization).
+ * @copyright      : Copyright (c) 2020 STMicroelectronics.
+ ******************************************************************************/
+
+#include "stm32_img.h"
+#include <stddef.h>
+
+/* Expansion of the RGB565 components to 8 bits */
+#define RGB565_R8(px)  ((((px) >> 8) & 0xf8u) | ((px) >> 13))
+#define RGB565_G8(px)  ((((px) >> 3) & 0xfcu) | (((px) >> 9) & 0x03u))
+#define RGB565_B8(px)  ((((px) << 3) & 0xf8u) | (((px) >> 2) & 0x07u))
+
+#define LERP_Q8(a, b, w)  ((((a) * (256 - (w))) + ((b) * (w)) + 128) >> 8)
+
+/* Output channel cursors: one pointer per R, G, B channel, all advancing by
+ * the same number of elements per pixel */
+typedef struct
+{
+  uint8_t *pChannel[3];
+  uint32_t step;
+} TensorCursor_t;
+
+static void TensorLine(const uint8_t *pLine0, const uint8_t *pLine1,
+                       uint32_t wy, uint32_t xRatio, uint32_t roiW,
+                       uint32_t dstW, uint32_t bilinear,
+                       const ImgTensor_t *tensor, TensorCursor_t *cursor,
+                       uint32_t elemSize);
+
+
+/**
+ * @brief  Initializes a tensor instance, building its per-channel tables.
+ *         To be called again whenever the parameters change.
+ * @param  tensor  Tensor instance
+ * @param  params  Tensor description
+ * @retval None
+ */
+void ImgTensorInit(ImgTensor_t *tensor, const ImgTensorParams_t *params)
+{
+  IMG_ASSERT(params->type <= TENSOR_UINT8);
+  IMG_ASSERT(params->type == TENSOR_FLOAT32 || params->qScale > 0.0f);
+
+  tensor->params = *params;
+
+  for (uint32_t c = 0; c < 3; c++)
+  {
+    for (uint32_t v = 0; v < 256; v++)
+    {
+      const float x = ((float) v - params->mean[c]) * params->scale[c];
+
+      if (params->type == TENSOR_FLOAT32)
+      {
+        tensor->lut.f32[c][v] = x;
+      }
+      else
+      {
+        const float q = x / params->qScale;
+        int32_t qi = (int32_t) (q + ((q >= 0.0f) ? 0.5f : -0.5f));
+        const int32_t qmin = (params->type == TENSOR_INT8) ? -128 : 0;
+        const int32_t qmax = (params->type == TENSOR_INT8) ? 127 : 255;
+
+        qi += params->qZeroPoint;
+        qi = (qi < qmin) ? qmin : ((qi > qmax) ? qmax : qi);
+        tensor->lut.q8[c][v] = (uint8_t) qi;
+      }
+    }
+  }
+}
+
+/**
+ * @brief  Returns the size in bytes of a tensor's data.
+ * @param  tensor  Tensor instance
+ * @retval Tensor size in bytes
+ */
+uint32_t ImgTensorSize(const ImgTensor_t *tensor)
+{
+  const uint32_t elem_size = (tensor->params.type == TENSOR_FLOAT32) ?
+                             sizeof(float) : sizeof(uint8_t);
+
+  return tensor->params.width * tensor->params.height * 3 * elem_size;
+}
+
+/**
+ * @brief  Builds a neural network input tensor from an RGB565 image in a
+ *         single pass: each tensor pixel is sampled in the ROI (nearest or
+ *         Q8 bilinear, same sampling positions as ImgResizeCropEx()),
+ *         expanded to 8-bit components, then normalized (and quantized)
+ *         through the tensor tables and written in the tensor layout and
+ *         channel order.
+ * @param  imgSrc  Source image, RGB565
+ * @param  roi     Region Of Interest, NULL for the whole image
+ * @param  intrpl  NEAREST or BILINEAR
+ * @param  tensor  Tensor instance, initialized by ImgTensorInit()
+ * @param  pOut    Tensor data, ImgTensorSize() bytes (4-byte aligned for
+ *                 TENSOR_FLOAT32)
+ * @retval IMG_OK, IMG_ERROR_FORMAT if the source is not RGB565 or IMG_ERROR if
+ *         the interpolation is not supported
+ */
+imgstatus_t ImgResizeCropToTensor(Image_t *imgSrc, ImgRect_t *roi,
+                                  intrpl_t intrpl, ImgTensor_t *tensor,
+                                  void *pOut)
+{
+  IMG_ASSERT(imgSrc->pData != NULL);
+  IMG_ASSERT(pOut != NULL);
+  IMG_ASSERT(roi == NULL || roi->x0 + roi->width <= imgSrc->width);
+  IMG_ASSERT(roi == NULL || roi->y0 + roi->height <= imgSrc->height);
+
+  if (imgSrc->format != PXFMT_RGB565)
+  {
+    return IMG_ERROR_FORMAT;
+  }
+  if (intrpl != NEAREST && intrpl != BILINEAR)
+  {
+    return IMG_ERROR;
+  }
+
+  const ImgTensorParams_t *params = &tensor->params;
+  const uint32_t dst_w = params->width;
+  const uint32_t dst_h = params->height;
+  const uint32_t elem_size = (params->type == TENSOR_FLOAT32) ?
+                             sizeof(float) : sizeof(uint8_t);
+  const uint32_t src_stride = IMG_STRIDE(imgSrc);
+  const uint32_t roi_x = (roi != NULL) ? roi->x0 : 0;
+  const uint32_t roi_y = (roi != NULL) ? roi->y0 : 0;
+  const uint32_t roi_w = (roi != NULL) ? roi->width : imgSrc->width;
+  const uint32_t roi_h = (roi != NULL) ? roi->height : imgSrc->height;
+  const uint32_t x_ratio = (roi_w << 16) / dst_w;
+  const uint32_t y_ratio = (roi_h << 16) / dst_h;
+  const uint32_t bilinear = (intrpl == BILINEAR);
+  const uint8_t *pRoi = (const uint8_t *) imgSrc->pData +
+                        roi_y * src_stride + roi_x * 2;
+  TensorCursor_t cursor;
+
+  /* Channel c of pixel i lives at pChannel[c] + i * step (in elements) */
+  uint32_t first[3];
+  uint32_t channel_ofs;
+  if (params->layout == TENSOR_HWC)
+  {
+    cursor.step = 3;
+    channel_ofs = 1;
+  }
+  else
+  {
+    cursor.step = 1;
+    channel_ofs = dst_w * dst_h;
+  }
+  first[0] = (params->order == TENSOR_RGB) ? 0 : 2 * channel_ofs;
+  first[1] = channel_ofs;
+  first[2] = (params->order == TENSOR_RGB) ? 2 * channel_ofs : 0;
+  for (uint32_t c = 0; c < 3; c++)
+  {
+    cursor.pChannel[c] = (uint8_t *) pOut + first[c] * elem_size;
+  }
+
+  for (uint32_t y = 0; y < dst_h; y++)
+  {
+    const uint32_t pos = y * y_ratio;
+    const uint32_t y0 = pos >> 16;
+    const uint32_t y1 = (y0 + 1 < roi_h) ? y0 + 1 : y0;
+    const uint32_t wy = bilinear ? ((pos >> 8) & 0xffu) : 0;
+
+    /* Constant element sizes let the compiler specialize both loops */
+    if (elem_size == sizeof(float))
+    {
+      TensorLine(pRoi + y0 * src_stride, pRoi + y1 * src_stride, wy, x_ratio,
+                 roi_w, dst_w, bilinear, tensor, &cursor, sizeof(float));
+    }
+    else
+    {
+      TensorLine(pRoi + y0 * src_stride, pRoi + y1 * src_stride, wy, x_ratio,
+                 roi_w, dst_w, bilinear, tensor, &cursor, sizeof(uint8_t));
+    }
+  }
+
+  return IMG_OK;
+}
+
+/**
+* @brief  Samples, converts and normalizes one tensor line, advancing the
+*         channel cursors.
+* @param  pLine0       Upper source line, at the ROI left edge
+* @param  pLine1       Lower source line, at the ROI left edge
+* @param  wy           Q8 vertical weight of the lower line
+* @param  xRatio       Q16 horizontal sampling step
+* @param  roiW         Region Of Interest width
+* @param  dstW         Tensor width
+* @param  bilinear     Whether to interpolate (otherwise nearest sample)
+* @param  tensor       Tensor instance
+* @param  cursor       Output channel cursors
+* @param  elemSize     Tensor element size in bytes
+* @retval void         None
+*/
+static inline __attribute__((always_inline))
+void TensorLine(const uint8_t *pLine0, const uint8_t *pLine1, uint32_t wy,
+                uint32_t xRatio, uint32_t roiW, uint32_t dstW,
+                uint32_t bilinear, const ImgTensor_t *tensor,
+                TensorCursor_t *cursor, uint32_t elemSize)
+{
+  const uint16_t *pIn0 = (const uint16_t *) pLine0;
+  const uint16_t *pIn1 = (const uint16_t *) pLine1;
+  const uint32_t step = cursor->step;
+  uint8_t *pR = cursor->pChannel[0];
+  uint8_t *pG = cursor->pChannel[1];
+  uint8_t *pB = cursor->pChannel[2];
+  uint32_t pos = 0;
+
+  for (uint32_t x = 0; x < dstW; x++, pos += xRatio)
+  {
+    const uint32_t x0 = pos >> 16;
+    const uint32_t p00 = pIn0[x0];
+    uint32_t r = RGB565_R8(p00);
+    uint32_t g = RGB565_G8(p00);
+    uint32_t b = RGB565_B8(p00);
+
+    if (bilinear)
+    {
+      const uint32_t x1 = (x0 + 1 < roiW) ? x0 + 1 : x0;
+      const uint32_t wx = (pos >> 8) & 0xffu;
+      const uint32_t p01 = pIn0[x1];
+      const uint32_t p10 = pIn1[x0];
+      const uint32_t p11 = pIn1[x1];
+
+      r = LERP_Q8(LERP_Q8(r, RGB565_R8(p01), wx),
+                  LERP_Q8(RGB565_R8(p10), RGB565_R8(p11), wx), wy);
+      g = LERP_Q8(LERP_Q8(g, RGB565_G8(p01), wx),
+                  LERP_Q8(RGB565_G8(p10), RGB565_G8(p11), wx), wy);
+      b = LERP_Q8(LERP_Q8(b, RGB565_B8(p01), wx),
+                  LERP_Q8(RGB565_B8(p10), RGB565_B8(p11), wx), wy);
+    }
+
+    if (elemSize == sizeof(float))
+    {
+      *(float *) pR = tensor->lut.f32[0][r];
+      *(float *) pG = tensor->lut.f32[1][g];
+      *(float *) pB = tensor->lut.f32[2][b];
+    }
+    else
+    {
+      *pR = tensor->lut.q8[0][r];
+      *pG = tensor->lut.q8[1][g];
+      *pB = tensor->lut.q8[2][b];
+    }
+    pR += step * elemSize;
+    pG += step * elemSize;
+    pB += step * elemSize;
+  }
+
+  cursor->pChannel[0] = pR;
+  cursor->pChannel[1] = pG;
+  cursor->pChannel[2] = pB;
+}
@@ -0,0 +1,164 @@
+/*
+ * This file is part of the microtrace project.
+ * Copyright (c) 2020 Thibaut Vercueil
+ * This work is licensed under the MIT license, see the file LICENSE for
+ * details.
+ *
+ * Host decoder of the compact microtrace dumps (MICROTRACE_DUMP): reads a
+ * serial capture, in which the dump lines may be mixed with other output,
+ * and writes the first complete dump as Chrome tracing JSON, to be opened in
+ * chrome://tracing or Perfetto. Ring mode streams (no event count) are
+ * decoded up to the end of the capture, the events dropped on the target
+ * being reported.
+ *
+ *   make host-microtrace
+ *   Build/host/microtrace_decode capture.log > trace.json
+ */
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LINE_LEN 1024
+
+typedef struct
+{
+  char *category;
+  char *name;
+} name_t;
+
+/* Prints a JSON string, escaping what needs to be */
+static void print_json_string(FILE *out, const char *s)
+{
+  fputc('"', out);
+  for (; *s != '\0'; s++) {
+    if ((*s == '"') || (*s == '\\')) {
+      fputc('\\', out);
+    }
+    if ((unsigned char)*s >= 0x20) {
+      fputc(*s, out);
+    }
+  }
+  fputc('"', out);
+}
+
+/* Duplicates a tab-terminated field, advancing the cursor past it */
+static char *next_field(char **cursor)
+{
+  char *start = *cursor;
+  size_t len = strcspn(start, "\t\r\n");
+  char *field = malloc(len + 1);
+
+  if (field == NULL) {
+    fprintf(stderr, "microtrace_decode: out of memory\n");
+    exit(1);
+  }
+  memcpy(field, start, len);
+  field[len] = '\0';
+  *cursor = start + len + ((start[len] == '\t') ? 1 : 0);
+  return field;
+}
+
+int main(int argc, char **argv)
+{
+  FILE *in = stdin;
+  FILE *out = stdout;
+  char line[LINE_LEN];
+  name_t *names = NULL;
+  unsigned long hz = 0;
+  unsigned long nb_names = 0;
+  unsigned long nb_events = 0;
+  unsigned long decoded = 0;
+  unsigned long dropped = 0;
+  uint64_t time = 0;
+  int in_dump = 0;
+  int done = 0;
+
+  if (argc > 2) {
+    fprintf(stderr, "usage: %s [capture.log]\n", argv[0]);
+    return 2;
+  }
+  if ((argc == 2) && ((in = fopen(argv[1], "r")) == NULL)) {
+    perror(argv[1]);
+    return 1;
+  }
+
+  while (!done && (fgets(line, sizeof(line), in) != NULL)) {
+    if (strncmp(line, "#MT ", 4) == 0) {
+      if (sscanf(line + 4, "%lu %lu %lu", &hz, &nb_names, &nb_events) != 3 ||
+          (hz == 0)) {
+        fprintf(stderr, "microtrace_decode: bad header: %s", line);
+        return 1;
+      }
+      names = calloc(nb_names ? nb_names : 1, sizeof(name_t));
+      if (names == NULL) {
+        fprintf(stderr, "microtrace_decode: out of memory\n");
+        return 1;
+      }
+      in_dump = 1;
+      fprintf(out, "{\"traceEvents\":[");
+    } else if (!in_dump) {
+      continue;
+    } else if (strncmp(line, "#MTN ", 5) == 0) {
+      char *cursor = line + 5;
+      unsigned long id = strtoul(cursor, &cursor, 10);
+
+      if ((id >= nb_names) || (*cursor++ != '\t')) {
+        fprintf(stderr, "microtrace_decode: bad name: %s", line);
+        return 1;
+      }
+      names[id].category = next_field(&cursor);
+      names[id].name = next_field(&cursor);
+    } else if (strncmp(line, "#MTD ", 5) == 0) {
+      dropped = strtoul(line + 5, NULL, 10);
+    } else if (strncmp(line, "#MTEND", 6) == 0) {
+      done = 1;
+    } else if (strncmp(line, "#MTE ", 5) == 0) {
+      const char *cursor = line + 4;
+      unsigned long ts;
+      unsigned int id, phase, wrap;
+      int len;
+
+      while (sscanf(cursor, " %8lx%4x%2x%2x%n", &ts, &id, &phase, &wrap,
+                    &len) == 4) {
+        /* 40-bit clock count, extended past the 8-bit wraps */
+        uint64_t event_time = (time & ~0xFFFFFFFFFFull) |
+                              ((uint64_t)wrap << 32) | ts;
+        const name_t *name = (id < nb_names) ? &names[id] : NULL;
+        uint64_t ns;
+
+        if (event_time < time) {
+          event_time += 1ull << 40;
+        }
+        time = event_time;
+        ns = (time / hz) * 1000000000u + ((time % hz) * 1000000000u) / hz;
+
+        fprintf(out, "%s\n{\"cat\":", (decoded++ != 0) ? "," : "");
+        print_json_string(out, (name && name->category) ? name->category : "?");
+        fprintf(out, ",\"name\":");
+        print_json_string(out, (name && name->name) ? name->name : "?");
+        fprintf(out, ",\"pid\":1,\"tid\":1,\"ts\":%" PRIu64 ".%03u,"
+                "\"ph\":\"%c\",\"args\":{}}",
+                ns / 1000u, (unsigned)(ns % 1000u), (char)phase);
+        cursor += len;
+      }
+    }
+  }
+
+  if (!in_dump) {
+    fprintf(stderr, "microtrace_decode: no dump found\n");
+    return 1;
+  }
+  fprintf(out, "\n],\"displayTimeUnit\":\"ns\"}\n");
+  if (dropped != 0) {
+    fprintf(stderr, "microtrace_decode: %lu events dropped by the target\n",
+            dropped);
+  }
+  if ((nb_events != 0) && (!done || (decoded != nb_events))) {
+    fprintf(stderr, "microtrace_decode: truncated dump, %lu of %lu events\n",
+            decoded, nb_events);
+    return 1;
+  }
+  return 0;
+}
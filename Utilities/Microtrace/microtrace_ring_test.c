@@ -0,0 +1,612 @@
+/*
+ * This file is part of the microtrace project.
+ * Copyright (c) 2020 Thibaut Vercueil
+ * This work is licensed under the MIT license, see the file LICENSE for
+ * details.
+ *
+ * Host test of the ring mode (MICROTRACE_RING). The exclusive accesses, the
+ * cycle counter and the stream output are emulated, and interrupts are run
+ * from within the exclusive accesses: before the store, which makes the
+ * reservation start over, or between the reservation and the commit of a
+ * record. The stream is checked record by record, then decoded by
+ * microtrace_decode and checked again.
+ *
+ *   make host-microtrace-test
+ */
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Emulated Cortex-M7 */
+#define __CORTEX_M 7U
+#define __LDREXW(ptr) test_ldrexw(ptr)
+#define __STREXW(value, ptr) test_strexw(value, ptr)
+#define __CLREX() test_clrex()
+#define __DMB() __asm__ volatile("" ::: "memory")
+
+typedef struct
+{
+  volatile uint32_t CTRL;
+  volatile uint32_t CYCCNT;
+  volatile uint32_t LAR;
+} test_dwt_t;
+
+typedef struct
+{
+  volatile uint32_t DEMCR;
+} test_core_debug_t;
+
+#define DWT (&test_dwt)
+#define CoreDebug (&test_core_debug)
+#define DWT_CTRL_CYCCNTENA_Msk (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+
+static test_dwt_t test_dwt;
+static test_core_debug_t test_core_debug;
+static uint32_t SystemCoreClock = 400000000u;
+
+static uint32_t test_ldrexw(volatile uint32_t *addr);
+static uint32_t test_strexw(uint32_t value, volatile uint32_t *addr);
+static void test_clrex(void);
+
+#include "microtrace.h"
+
+#if defined(MICROTRACE_DISABLE) || !defined(MICROTRACE_RING)
+#error "The ring test needs MICROTRACE_ENABLE and MICROTRACE_RING"
+#endif
+
+#define TEST_MAX_RECORDS (4 * MICROTRACE_MAX_EVENTS)
+#define TEST_MAX_DEPTH 4
+#define TEST_DROPS 5
+
+/* Event sites, one name each */
+enum
+{
+  SITE_WRITER,
+  SITE_INTERRUPT,
+  SITE_NESTED,
+  SITE_BEGIN,
+  SITE_END,
+  SITE_COUNT
+};
+
+static const struct
+{
+  const char *category;
+  const char *name;
+  char phase;
+} test_sites[SITE_COUNT] = {
+    {"ring", "writer", 'I'},  {"ring", "interrupt", 'I'},
+    {"ring", "nested", 'I'},  {"wrap", "period", 'B'},
+    {"wrap", "period", 'E'},
+};
+
+/* Expected record, by reservation order */
+typedef struct
+{
+  uint64_t time;
+  uint8_t site;
+  uint8_t set;
+} test_record_t;
+
+static test_record_t test_expected[TEST_MAX_RECORDS];
+static uint32_t test_expected_count;
+
+/* Clock count, 64 bits */
+static uint64_t test_time;
+
+/* Exclusive monitor, interrupt nesting, and the reservation of each level */
+static uint32_t test_monitor;
+static uint32_t test_depth;
+static uint64_t test_ldrex_time[TEST_MAX_DEPTH];
+static uint32_t test_reserved[TEST_MAX_DEPTH];
+static uint64_t test_reserved_time[TEST_MAX_DEPTH];
+static uint32_t test_reserved_valid[TEST_MAX_DEPTH];
+static uint32_t test_strex_failures;
+
+/* One-shot interrupts, on the next head store */
+static void (*test_irq_before_store)(void);
+static void (*test_irq_after_store)(void);
+
+/* Stream output: serial capture, and busy responses to give */
+static char *test_capture;
+static size_t test_capture_len;
+static size_t test_capture_size;
+static uint32_t test_output_busy;
+
+/* Results */
+static const char *test_name;
+static uint32_t test_cases;
+static uint32_t test_failed;
+static uint32_t test_case_failed;
+
+#define TEST_CHECK(cond) test_check((cond), #cond, __LINE__)
+
+static void test_begin(const char *name)
+{
+  test_name = name;
+  test_case_failed = 0;
+  test_cases++;
+}
+
+static void test_check(int cond, const char *what, int line)
+{
+  if (!cond) {
+    printf("  %s: line %d: %s\n", test_name, line, what);
+    test_case_failed = 1;
+  }
+}
+
+static void test_end(void)
+{
+  if (test_case_failed) {
+    test_failed++;
+    printf("FAIL %s\n", test_name);
+  } else {
+    printf("ok   %s\n", test_name);
+  }
+}
+
+/* Advances the clock */
+static void test_tick(uint32_t count)
+{
+  test_time += count;
+  test_dwt.CYCCNT = (uint32_t)test_time;
+}
+
+/* Runs a one-shot interrupt, if any. Exception entry and return clear the
+ * exclusive monitor */
+static void test_irq(void (**handler)(void))
+{
+  void (*irq)(void) = *handler;
+
+  if (irq != NULL) {
+    *handler = NULL;
+    test_depth++;
+    irq();
+    test_depth--;
+    test_monitor = 0;
+  }
+}
+
+static uint32_t test_ldrexw(volatile uint32_t *addr)
+{
+  test_monitor = 1;
+  test_ldrex_time[test_depth] = test_time;
+  return *addr;
+}
+
+static uint32_t test_strexw(uint32_t value, volatile uint32_t *addr)
+{
+  const int head = (addr == &microtrace_ring_head);
+
+  if (head) {
+    test_irq(&test_irq_before_store);
+  }
+  if (!test_monitor) {
+    test_strex_failures++;
+    return 1;
+  }
+  test_monitor = 0;
+  *addr = value;
+  if (head) {
+    /* The clock is read right after the load */
+    test_reserved[test_depth] = value - 1;
+    test_reserved_time[test_depth] = test_ldrex_time[test_depth];
+    test_reserved_valid[test_depth] = 1;
+    test_irq(&test_irq_after_store);
+  }
+  return 0;
+}
+
+static void test_clrex(void)
+{
+  test_monitor = 0;
+}
+
+/* Records an event from a site, and the expected record if not dropped.
+ * Returns 1 if recorded */
+static int test_event(uint32_t site)
+{
+  const uint32_t depth = test_depth;
+  test_record_t *record;
+
+  test_reserved_valid[depth] = 0;
+  switch (site) {
+  case SITE_WRITER:
+    MICROTRACE_INSTANT("ring", "writer");
+    break;
+  case SITE_INTERRUPT:
+    MICROTRACE_INSTANT("ring", "interrupt");
+    break;
+  case SITE_NESTED:
+    MICROTRACE_INSTANT("ring", "nested");
+    break;
+  case SITE_BEGIN:
+    MICROTRACE_BEGIN("wrap", "period");
+    break;
+  default:
+    MICROTRACE_END("wrap", "period");
+    break;
+  }
+  if (!test_reserved_valid[depth] ||
+      (test_reserved[depth] >= TEST_MAX_RECORDS)) {
+    return 0;
+  }
+  record = &test_expected[test_reserved[depth]];
+  record->time = test_reserved_time[depth];
+  record->site = (uint8_t)site;
+  record->set = 1;
+  if (test_reserved[depth] >= test_expected_count) {
+    test_expected_count = test_reserved[depth] + 1;
+  }
+  return 1;
+}
+
+/* Appends to the serial capture, kept null-terminated */
+static void test_append(const char *data, size_t size)
+{
+  if (test_capture_len + size + 1 > test_capture_size) {
+    test_capture_size = 2 * (test_capture_len + size + 1);
+    test_capture = realloc(test_capture, test_capture_size);
+    if (test_capture == NULL) {
+      fprintf(stderr, "microtrace_ring_test: out of memory\n");
+      exit(1);
+    }
+  }
+  memcpy(test_capture + test_capture_len, data, size);
+  test_capture_len += size;
+  test_capture[test_capture_len] = '\0';
+}
+
+/* Ring mode output: the transfers complete in test_stream() */
+int microtrace_stream_write(const char *pData, uint32_t size)
+{
+  if (test_output_busy != 0) {
+    test_output_busy--;
+    return 0;
+  }
+  test_append(pData, size);
+  return 1;
+}
+
+/* Streams until the output idles, as the transfer completion would */
+static void test_stream(void)
+{
+  for (;;) {
+    MICROTRACE_STREAM_POLL();
+    if (!microtrace_stream_busy) {
+      break;
+    }
+    MICROTRACE_STREAM_DONE();
+  }
+}
+
+/* Interrupt recording an event */
+static void test_irq_event(void)
+{
+  test_tick(10);
+  test_event(SITE_INTERRUPT);
+  test_tick(10);
+}
+
+/* Interrupt preempting an interrupt */
+static void test_irq_nested(void)
+{
+  test_tick(10);
+  test_event(SITE_NESTED);
+  test_tick(10);
+}
+
+/* Interrupt recording an event, itself preempted before its store */
+static void test_irq_preempted(void)
+{
+  test_irq_before_store = test_irq_nested;
+  test_irq_event();
+}
+
+/* Interrupt recording an event and streaming, while the record it preempted
+ * is reserved but not committed */
+static uint32_t test_stall_tail;
+
+static void test_irq_stream(void)
+{
+  const size_t len = test_capture_len;
+
+  test_irq_event();
+  TEST_CHECK(microtrace_ring_head - microtrace_ring_tail == 2);
+  test_stream();
+  TEST_CHECK(test_capture_len == len);
+  TEST_CHECK(microtrace_ring_tail == test_stall_tail);
+}
+
+static void test_header(void)
+{
+  const uint32_t names = __microtrace_names_end - __microtrace_names_start;
+  char line[64];
+
+  test_begin("stream header and name table");
+  MICROTRACE_INIT();
+  TEST_CHECK(test_dwt.CTRL & DWT_CTRL_CYCCNTENA_Msk);
+  TEST_CHECK(test_core_debug.DEMCR & CoreDebug_DEMCR_TRCENA_Msk);
+  TEST_CHECK(names == SITE_COUNT);
+  test_stream();
+  snprintf(line, sizeof(line), "#MT %lu %lu 0\r\n",
+           (unsigned long)SystemCoreClock, (unsigned long)names);
+  TEST_CHECK(strncmp(test_capture, line, strlen(line)) == 0);
+  for (uint32_t i = 0; i < names; i++) {
+    snprintf(line, sizeof(line), "#MTN %lu\t%s\t%s\r\n", (unsigned long)i,
+             __microtrace_names_start[i].category,
+             __microtrace_names_start[i].name);
+    TEST_CHECK(strstr(test_capture, line) != NULL);
+  }
+  TEST_CHECK(strstr(test_capture, "#MTE") == NULL);
+  test_end();
+}
+
+static void test_retry(void)
+{
+  test_begin("reservation retry on preemption");
+  for (uint32_t i = 0; i < 3; i++) {
+    const uint32_t head = microtrace_ring_head;
+    const uint32_t failures = test_strex_failures;
+
+    test_tick(1000);
+    test_irq_before_store = test_irq_event;
+    TEST_CHECK(test_event(SITE_WRITER));
+    TEST_CHECK(test_strex_failures == failures + 1);
+    TEST_CHECK(microtrace_ring_head == head + 2);
+    /* The writer's record follows the interrupt's, and is later */
+    TEST_CHECK(test_expected[head].site == SITE_INTERRUPT);
+    TEST_CHECK(test_expected[head + 1].site == SITE_WRITER);
+    TEST_CHECK(test_expected[head + 1].time > test_expected[head].time);
+  }
+  test_end();
+
+  test_begin("reservation retry on nested preemption");
+  {
+    const uint32_t head = microtrace_ring_head;
+    const uint32_t failures = test_strex_failures;
+
+    test_tick(1000);
+    test_irq_before_store = test_irq_preempted;
+    TEST_CHECK(test_event(SITE_WRITER));
+    TEST_CHECK(test_strex_failures == failures + 2);
+    TEST_CHECK(microtrace_ring_head == head + 3);
+    TEST_CHECK(test_expected[head].site == SITE_NESTED);
+    TEST_CHECK(test_expected[head + 1].site == SITE_INTERRUPT);
+    TEST_CHECK(test_expected[head + 2].site == SITE_WRITER);
+    TEST_CHECK(test_expected[head + 1].time > test_expected[head].time);
+    TEST_CHECK(test_expected[head + 2].time > test_expected[head + 1].time);
+  }
+  test_stream();
+  TEST_CHECK(microtrace_ring_tail == microtrace_ring_head);
+  test_end();
+}
+
+static void test_stall(void)
+{
+  test_begin("stream stall on an uncommitted record");
+  test_stream();
+  test_stall_tail = microtrace_ring_tail;
+  test_tick(1000);
+  test_irq_after_store = test_irq_stream;
+  TEST_CHECK(test_event(SITE_WRITER));
+  TEST_CHECK(test_irq_after_store == NULL);
+  /* Committed: both records go, the writer's first */
+  test_stream();
+  TEST_CHECK(microtrace_ring_tail == test_stall_tail + 2);
+  TEST_CHECK(test_expected[test_stall_tail].site == SITE_WRITER);
+  TEST_CHECK(test_expected[test_stall_tail + 1].site == SITE_INTERRUPT);
+  test_end();
+}
+
+static void test_drops(void)
+{
+  const char *other = "other output\r\n";
+  char drops[16];
+  size_t len;
+
+  test_begin("full ring drops and drop count line");
+  test_stream();
+  /* Other output of the application, among the stream lines */
+  test_append(other, strlen(other));
+  for (uint32_t i = 0; i < MICROTRACE_MAX_EVENTS; i++) {
+    test_tick(1);
+    if (!test_event(SITE_WRITER)) {
+      break;
+    }
+  }
+  TEST_CHECK(microtrace_ring_head - microtrace_ring_tail ==
+             MICROTRACE_MAX_EVENTS);
+  TEST_CHECK(microtrace_ring_dropped == 0);
+  for (uint32_t i = 0; i < TEST_DROPS; i++) {
+    const uint32_t head = microtrace_ring_head;
+
+    test_tick(1);
+    TEST_CHECK(!test_event(SITE_WRITER));
+    TEST_CHECK(microtrace_ring_head == head);
+  }
+  TEST_CHECK(microtrace_ring_dropped == TEST_DROPS);
+
+  /* Busy output: the data is kept for the next poll */
+  len = test_capture_len;
+  test_output_busy = 1;
+  MICROTRACE_STREAM_POLL();
+  TEST_CHECK(test_capture_len == len);
+  TEST_CHECK(microtrace_stream_pending != 0);
+  TEST_CHECK(!microtrace_stream_busy);
+  test_stream();
+  TEST_CHECK(microtrace_ring_tail == microtrace_ring_head);
+  snprintf(drops, sizeof(drops), "#MTD %u\r\n", TEST_DROPS);
+  TEST_CHECK(strstr(test_capture + len, drops) != NULL);
+  TEST_CHECK(strstr(test_capture + len, drops) ==
+             strstr(test_capture, "#MTD"));
+
+  /* Recording again once streamed */
+  test_tick(1);
+  TEST_CHECK(test_event(SITE_WRITER));
+  test_stream();
+  test_append(other, strlen(other));
+  test_end();
+}
+
+static void test_wrap(void)
+{
+  test_begin("clock wraps past 40 bits");
+  /* Less than a wrap period between records */
+  for (uint32_t i = 0; i < 800; i++) {
+    test_tick(3000000000u);
+    TEST_CHECK(test_event((i & 1) ? SITE_END : SITE_BEGIN));
+    if ((i % 100) == 99) {
+      test_stream();
+    }
+  }
+  test_stream();
+  TEST_CHECK(microtrace_ring_tail == microtrace_ring_head);
+  TEST_CHECK(test_time > (1ull << 40));
+  TEST_CHECK(microtrace_clock_wraps > 256);
+  test_end();
+}
+
+/* Checks a decoded record against the expected one. Returns 1 if equal */
+static int test_match(uint32_t index, uint64_t time, const char *category,
+                      const char *name, char phase)
+{
+  const test_record_t *record = &test_expected[index];
+
+  return record->set && (record->time == time) &&
+         (strcmp(category, test_sites[record->site].category) == 0) &&
+         (strcmp(name, test_sites[record->site].name) == 0) &&
+         (phase == test_sites[record->site].phase);
+}
+
+static void test_records(void)
+{
+  const char *line = test_capture;
+  uint64_t time = 0;
+  uint32_t count = 0;
+  uint32_t mismatch = 0;
+
+  test_begin("stream records, with 40-bit times");
+  while ((line = strstr(line, "#MTE")) != NULL) {
+    const char *cursor = line + 4;
+    unsigned long ts;
+    unsigned int id, phase, wrap;
+    int len;
+
+    while (sscanf(cursor, " %8lx%4x%2x%2x%n", &ts, &id, &phase, &wrap,
+                  &len) == 4) {
+      microtrace_event_t event = {(uint32_t)ts, (uint16_t)id, (uint8_t)phase,
+                                  (uint8_t)wrap};
+
+      time = microtrace_event_time(&event, time);
+      if ((count >= test_expected_count) || (id >= SITE_COUNT) ||
+          !test_match(count, time, __microtrace_names_start[id].category,
+                      __microtrace_names_start[id].name, (char)phase)) {
+        mismatch++;
+      }
+      count++;
+      cursor += len;
+    }
+    line = cursor;
+  }
+  TEST_CHECK(count == test_expected_count);
+  TEST_CHECK(mismatch == 0);
+  test_end();
+}
+
+static void test_decoder(const char *decoder, const char *capture)
+{
+  char json[512];
+  char command[1024];
+  char line[256];
+  FILE *file;
+  FILE *report;
+  uint32_t count = 0;
+  uint32_t mismatch = 0;
+  unsigned long dropped = 0;
+
+  test_begin("decoder round trip");
+  snprintf(json, sizeof(json), "%s.json", capture);
+  file = fopen(capture, "wb");
+  TEST_CHECK(file != NULL);
+  if (file == NULL) {
+    test_end();
+    return;
+  }
+  fwrite(test_capture, 1, test_capture_len, file);
+  fclose(file);
+
+  /* JSON to a file, the report to the pipe */
+  snprintf(command, sizeof(command), "%s %s 2>&1 >%s", decoder, capture, json);
+  report = popen(command, "r");
+  TEST_CHECK(report != NULL);
+  if (report == NULL) {
+    test_end();
+    return;
+  }
+  while (fgets(line, sizeof(line), report) != NULL) {
+    if (sscanf(line, "microtrace_decode: %lu events dropped", &dropped) != 1) {
+      printf("  %s: %s", test_name, line);
+    }
+  }
+  TEST_CHECK(pclose(report) == 0);
+  TEST_CHECK(dropped == TEST_DROPS);
+
+  file = fopen(json, "r");
+  TEST_CHECK(file != NULL);
+  if (file == NULL) {
+    test_end();
+    return;
+  }
+  while (fgets(line, sizeof(line), file) != NULL) {
+    char category[MICROTRACE_MAX_STRING_LEN];
+    char name[MICROTRACE_MAX_STRING_LEN];
+    uint64_t us;
+    unsigned int frac;
+    char phase;
+
+    if (strncmp(line, "{\"cat\":", 7) != 0) {
+      continue;
+    }
+    if ((sscanf(line,
+                "{\"cat\":\"%31[^\"]\",\"name\":\"%31[^\"]\",\"pid\":1,"
+                "\"tid\":1,\"ts\":%" SCNu64 ".%3u,\"ph\":\"%c\"",
+                category, name, &us, &frac, &phase) != 5) ||
+        (count >= test_expected_count) ||
+        (us * 1000u + frac !=
+         microtrace_timestamp_to_ns(test_expected[count].time)) ||
+        !test_match(count, test_expected[count].time, category, name,
+                    phase)) {
+      mismatch++;
+    }
+    count++;
+  }
+  fclose(file);
+  TEST_CHECK(count == test_expected_count);
+  TEST_CHECK(mismatch == 0);
+  test_end();
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 3) {
+    fprintf(stderr, "usage: %s <microtrace_decode> <capture.log>\n",
+            argv[0]);
+    return 2;
+  }
+
+  test_header();
+  test_retry();
+  test_stall();
+  test_drops();
+  test_wrap();
+  test_records();
+  test_decoder(argv[1], argv[2]);
+
+  printf("%u cases, %u failed\n", test_cases, test_failed);
+  return (test_failed != 0) ? 1 : 0;
+}